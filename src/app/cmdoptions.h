@@ -20,7 +20,8 @@ enum class ConvertType {
     ExportScoreTranspose,
     ExportScoreElements,
     SourceUpdate,
-    ExportScoreVideo
+    ExportScoreVideo,
+    ProbeScores
 };
 
 enum class DiagnosticType {
@@ -46,6 +47,9 @@ struct MuseScoreCmdOptions : public muse::CmdOptions {
         PageNumber,
         ScoreRegion,
         NoAudio,
+        BatchWorkers,
+        BatchReportPath,
+        ProbeFiles,
     };
 
     struct {
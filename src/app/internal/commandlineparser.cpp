@@ -90,6 +90,12 @@ void CommandLineParser::init()
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
     m_parser.addOption(QCommandLineOption("extension", "Use extension to process a conversion job", "uri"));
+    m_parser.addOption(QCommandLineOption("batch-workers",
+                                          "Use with '-j <file>', convert the jobs concurrently in the given number of worker processes",
+                                          "count"));
+    m_parser.addOption(QCommandLineOption("batch-report",
+                                          "Use with '-j <file>', write a JSON report with per-job timing and peak memory to the given file",
+                                          "file"));
 
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -111,6 +117,9 @@ void CommandLineParser::init()
     m_parser.addOption(QCommandLineOption("score-elements",
                                           "Scan the given score and export elements to a single JSON file, print it to stdout"));
     m_parser.addOption(QCommandLineOption("source-update", "Update the source in the given score"));
+    m_parser.addOption(QCommandLineOption("score-probe",
+                                          "Read the metadata of the given scores without loading them and print a JSON line per score to stdout "
+                                          "(or to '-o <file>'), use '--batch-workers <count>' to set the number of threads"));
 
     m_parser.addOption(QCommandLineOption({ "S", "style" }, "Load style file", "style"));
 
@@ -350,6 +359,20 @@ void CommandLineParser::parse(int argc, char** argv)
         m_options->runMode = IApplication::RunMode::ConsoleApp;
         m_options->converterTask.type = ConvertType::Batch;
         m_options->converterTask.inputFile = fromUserInputPath(m_parser.value("j"));
+
+        if (m_parser.isSet("batch-workers")) {
+            std::optional<int> val = intValue("batch-workers");
+            if (val && val.value() > 0) {
+                m_options->converterTask.params[MuseScoreCmdOptions::ParamKey::BatchWorkers] = val.value();
+            } else {
+                LOGE() << "Option: --batch-workers not recognized worker count: " << m_parser.value("batch-workers");
+            }
+        }
+
+        if (m_parser.isSet("batch-report")) {
+            m_options->converterTask.params[MuseScoreCmdOptions::ParamKey::BatchReportPath]
+                = fromUserInputPath(m_parser.value("batch-report"));
+        }
     }
 
     if (m_parser.isSet("score-media")) {
@@ -362,6 +385,22 @@ void CommandLineParser::parse(int argc, char** argv)
         }
     }
 
+    if (m_parser.isSet("score-probe")) {
+        m_options->runMode = IApplication::RunMode::ConsoleApp;
+        m_options->converterTask.type = ConvertType::ProbeScores;
+        m_options->converterTask.params[MuseScoreCmdOptions::ParamKey::ProbeFiles] = scorefiles;
+        m_options->converterTask.outputFile = fromUserInputPath(m_parser.value("o"));
+
+        if (m_parser.isSet("batch-workers")) {
+            std::optional<int> val = intValue("batch-workers");
+            if (val && val.value() > 0) {
+                m_options->converterTask.params[MuseScoreCmdOptions::ParamKey::BatchWorkers] = val.value();
+            } else {
+                LOGE() << "Option: --batch-workers not recognized worker count: " << m_parser.value("batch-workers");
+            }
+        }
+    }
+
     if (m_parser.isSet("score-meta")) {
         m_options->runMode = IApplication::RunMode::ConsoleApp;
         m_options->converterTask.type = ConvertType::ExportScoreMeta;
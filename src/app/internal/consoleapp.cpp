@@ -211,9 +211,12 @@ int MuseScoreConsoleApp::processConverter(const MuseScoreCmdOptions::ConverterTa
     openParams.unrollRepeats = task.params[MuseScoreCmdOptions::ParamKey::UnrollRepeats].toBool();
 
     switch (task.type) {
-    case ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, openParams, soundProfile, extensionUri);
-        break;
+    case ConvertType::Batch: {
+        converter::BatchParams batchParams;
+        batchParams.workers = task.params.value(MuseScoreCmdOptions::ParamKey::BatchWorkers, 1).toInt();
+        batchParams.reportPath = task.params[MuseScoreCmdOptions::ParamKey::BatchReportPath].toString();
+        ret = converter()->batchConvert(task.inputFile, openParams, soundProfile, extensionUri, batchParams);
+    } break;
     case ConvertType::File: {
         std::string transposeOptionsJson = task.params[MuseScoreCmdOptions::ParamKey::ScoreTransposeOptions].toString().toStdString();
         std::optional<ConvertTarget> target = parseTarget(task.params);
@@ -248,6 +251,14 @@ int MuseScoreConsoleApp::processConverter(const MuseScoreCmdOptions::ConverterTa
         bool withAudio = !task.params[MuseScoreCmdOptions::ParamKey::NoAudio].toBool();
         ret = converter()->exportScoreVideo(task.inputFile, task.outputFile, openParams, withAudio);
     } break;
+    case ConvertType::ProbeScores: {
+        std::vector<io::path_t> ins;
+        for (const QString& file : task.params[MuseScoreCmdOptions::ParamKey::ProbeFiles].toStringList()) {
+            ins.push_back(file);
+        }
+        int workers = task.params.value(MuseScoreCmdOptions::ParamKey::BatchWorkers, 0).toInt();
+        ret = converter()->probeScores(ins, task.outputFile, workers);
+    } break;
     case ConvertType::SourceUpdate: {
         std::string scoreSource = task.params[MuseScoreCmdOptions::ParamKey::ScoreSource].toString().toStdString();
         ret = converter()->updateSource(task.inputFile, scoreSource, openParams.forceMode);
@@ -528,6 +528,7 @@ MenuItem* AppMenuModel::makeDiagnosticsMenu()
             makeMenuItem("diagnostic-show-engraving-elements"),
             makeMenuItem("diagnostic-show-engraving-undostack"),
             makeMenuItem("diagnostic-show-engraving-style"),
+            makeMenuItem("diagnostic-show-engraving-cmdlatency"),
             makeSeparator(),
             makeMenuItem("show-element-bounding-rects"),
             makeMenuItem("color-element-shapes"),
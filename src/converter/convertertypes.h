@@ -37,4 +37,13 @@ using ConvertRegionJson = std::string;
 using page_num_t = size_t;
 using ConvertTarget = std::variant<ConvertRegionJson, page_num_t>;
 using OpenParams = project::OpenParams;
+
+struct BatchParams {
+    //! NOTE Number of worker processes that convert jobs concurrently,
+    //! each job in its own process; 1 means convert in this process
+    int workers = 1;
+
+    //! NOTE If set, a JSON report with per-job timing and peak memory is written here
+    muse::io::path_t reportPath;
+};
 }
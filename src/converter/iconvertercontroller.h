@@ -21,6 +21,8 @@
  */
 #pragma once
 
+#include <vector>
+
 #include "modularity/imoduleinterface.h"
 
 #include "convertertypes.h"
@@ -44,7 +46,7 @@ public:
 
     virtual muse::Ret batchConvert(const muse::io::path_t& batchJobFile, const OpenParams& openParams = {},
                                    const muse::String& soundProfile = {}, const muse::UriQuery& extensionUri = {},
-                                   muse::ProgressPtr progress = nullptr) = 0;
+                                   const BatchParams& batchParams = {}, muse::ProgressPtr progress = nullptr) = 0;
 
     virtual muse::Ret convertScoreParts(const muse::io::path_t& in, const muse::io::path_t& out, const OpenParams& openParams = {}) = 0;
 
@@ -62,5 +64,7 @@ public:
                                        bool withAudio = true) = 0;
 
     virtual muse::Ret updateSource(const muse::io::path_t& in, const std::string& newSource, bool forceMode = false) = 0;
+
+    virtual muse::Ret probeScores(const std::vector<muse::io::path_t>& ins, const muse::io::path_t& out, int workers = 0) = 0;
 };
 }
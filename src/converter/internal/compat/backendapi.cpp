@@ -22,6 +22,8 @@
 #include "backendapi.h"
 
 #include <stdio.h>
+#include <atomic>
+#include <thread>
 
 #include <QString>
 #include <QJsonDocument>
@@ -29,8 +31,11 @@
 #include <QJsonArray>
 #include <QJsonValue>
 #include <QRandomGenerator>
+#include <QBuffer>
+#include <QPdfWriter>
 
 #include "io/buffer.h"
+#include "draw/painter.h"
 
 #include "engraving/infrastructure/mscwriter.h"
 #include "engraving/dom/excerpt.h"
@@ -52,6 +57,7 @@ using namespace mu::notation;
 using namespace mu::engraving;
 using namespace muse;
 using namespace muse::io;
+using namespace muse::draw;
 
 static const std::string PNG_WRITER_NAME = "png";
 static const std::string SVG_WRITER_NAME = "svg";
@@ -80,6 +86,16 @@ Ret BackendApi::exportScoreMedia(const muse::io::path_t& in, const muse::io::pat
 
     INotationPtr notation = prj.val->masterNotation()->notation();
 
+    //! NOTE The pages are painted once here, the PNG, PDF writers replay the recorded pages.
+    //! Both write every page
+    notation->painting()->recordPageDisplayLists(0, -1);
+
+    //! NOTE The PDF is written in the background from the recorded pages, taken now, while the other
+    //! media are written here. Those use the score (the SVG writer recolours the beats and sets
+    //! the printing state, the MIDI and positions writers update the repeat list), so they keep
+    //! running one after another on this thread. The JSON is still written in the fixed order
+    std::future<RetVal<ByteArray> > pdfData = schedulePdf(notation);
+
     bool result = true;
 
     QFile outputFile;
@@ -93,7 +109,7 @@ Ret BackendApi::exportScoreMedia(const muse::io::path_t& in, const muse::io::pat
                                            notation, jsonWriter, ADD_SEPARATOR);
     result &= exportScoreElementsPositions(MEASURES_POSITIONS_WRITER_NAME, MEASURES_POSITIONS_TAG_NAME,
                                            notation, jsonWriter, ADD_SEPARATOR);
-    result &= exportScorePdf(notation, jsonWriter, ADD_SEPARATOR);
+    result &= exportScorePdf(pdfData, jsonWriter, ADD_SEPARATOR);
     result &= exportScoreMidi(notation, jsonWriter, ADD_SEPARATOR);
     result &= exportScoreMusicXML(notation, jsonWriter, ADD_SEPARATOR);
     result &= exportScoreMetaData(notation, jsonWriter, ADD_SEPARATOR);
@@ -208,6 +224,100 @@ Ret BackendApi::exportScoreElements(const muse::io::path_t& in, const muse::io::
     return doExportScoreElements(notation, outputFile);
 }
 
+Ret BackendApi::probeScores(const std::vector<muse::io::path_t>& ins, const muse::io::path_t& out, int workers)
+{
+    TRACEFUNC
+
+    QFile outputFile;
+    Ret ret = openOutputFile(outputFile, out);
+    if (!ret) {
+        return ret;
+    }
+
+    if (ins.empty()) {
+        return make_ok();
+    }
+
+    //! NOTE The reader is resolved here, on the calling thread, and the first score is probed
+    //! before the threads are started, so the services it uses are resolved too
+    std::shared_ptr<IMscMetaReader> metaReader = mscMetaReader();
+    IF_ASSERT_FAILED(metaReader) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    std::vector<QByteArray> lines(ins.size());
+    lines[0] = probeJsonLine(metaReader, ins[0]);
+
+    //! NOTE Probing doesn't load the scores, so nothing is shared between the files:
+    //! every thread takes the next file to probe, the lines are written in the input order
+    std::atomic<size_t> next = 1;
+    auto probeNext = [&ins, &lines, &next, metaReader]() {
+        for (size_t i = next++; i < ins.size(); i = next++) {
+            lines[i] = probeJsonLine(metaReader, ins[i]);
+        }
+    };
+
+#ifdef MUSE_THREADS_SUPPORT
+    size_t threadCount = workers > 0 ? static_cast<size_t>(workers) : std::max(std::thread::hardware_concurrency(), 1u);
+    threadCount = std::min(threadCount, ins.size() - 1);
+
+    std::vector<std::future<void> > threads;
+    for (size_t t = 1; t < threadCount; ++t) {
+        threads.push_back(std::async(std::launch::async, probeNext));
+    }
+
+    probeNext();
+
+    for (std::future<void>& thread : threads) {
+        thread.wait();
+    }
+#else
+    UNUSED(workers);
+    probeNext();
+#endif
+
+    bool success = true;
+    for (const QByteArray& line : lines) {
+        success &= outputFile.write(line) == line.size();
+    }
+
+    outputFile.close();
+
+    return success ? make_ok() : make_ret(Ret::Code::InternalError);
+}
+
+QByteArray BackendApi::probeJsonLine(std::shared_ptr<IMscMetaReader> metaReader, const muse::io::path_t& in)
+{
+    QJsonObject json;
+    json["file"] = in.toQString();
+
+    RetVal<ProjectProbe> probe = metaReader->probe(in);
+    if (!probe.ret) {
+        LOGE() << "failed probe score: " << in << ", err: " << probe.ret.toString();
+        json["error"] = QString::fromStdString(probe.ret.toString());
+        return QJsonDocument(json).toJson(QJsonDocument::Compact) + '\n';
+    }
+
+    const ProjectMeta& meta = probe.val.meta;
+    json["title"] = meta.title;
+    json["subtitle"] = meta.subtitle;
+    json["composer"] = meta.composer;
+    json["poet"] = meta.lyricist;
+    json["arranger"] = meta.arranger;
+    json["parts"] = static_cast<int>(meta.partsCount); // no = operator for size_t
+    json["measures"] = static_cast<int>(probe.val.measuresCount);
+    json["duration"] = probe.val.durationSecs;
+
+    QJsonArray keysigs;
+    for (int key : probe.val.keySignatures) {
+        keysigs.append(key);
+    }
+    json["keysigs"] = keysigs;
+    json["timesigs"] = QJsonArray::fromStringList(probe.val.timeSignatures);
+
+    return QJsonDocument(json).toJson(QJsonDocument::Compact) + '\n';
+}
+
 Ret BackendApi::openOutputFile(QFile& file, const muse::io::path_t& out)
 {
     bool ok = false;
@@ -316,7 +426,7 @@ Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendJsonWriter&
         }
 
         bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(pngData.toQByteArrayNoCopy().toBase64(), !lastArrayValue);
+        jsonWriter.addBase64Value(pngData.toQByteArrayNoCopy(), !lastArrayValue);
     }
 
     jsonWriter.closeArray(addSeparator);
@@ -359,7 +469,7 @@ Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const muse::io::pat
         }
 
         bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(svgData.toQByteArrayNoCopy().toBase64(), !lastArrayValue);
+        jsonWriter.addBase64Value(svgData.toQByteArrayNoCopy(), !lastArrayValue);
     }
 
     jsonWriter.closeArray(addSeparator);
@@ -372,13 +482,13 @@ Ret BackendApi::exportScoreElementsPositions(const std::string& elementsPosition
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(elementsPositionsWriterName, notation);
+    RetVal<ByteArray> writerRetVal = processWriterData(elementsPositionsWriterName, notation);
     if (!writerRetVal.ret) {
         return writerRetVal.ret;
     }
 
     jsonWriter.addKey(elementsPositionsTagName.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator, false);
+    jsonWriter.addBase64Value(writerRetVal.val.toQByteArrayNoCopy(), addSeparator);
 
     return make_ret(Ret::Code::Ok);
 }
@@ -387,13 +497,13 @@ Ret BackendApi::exportScorePdf(const INotationPtr notation, BackendJsonWriter& j
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(PDF_WRITER_NAME, notation);
+    RetVal<ByteArray> writerRetVal = processWriterData(PDF_WRITER_NAME, notation);
     if (!writerRetVal.ret) {
         return writerRetVal.ret;
     }
 
     jsonWriter.addKey(PDF_WRITER_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
+    jsonWriter.addBase64Value(writerRetVal.val.toQByteArrayNoCopy(), addSeparator);
 
     return make_ret(Ret::Code::Ok);
 }
@@ -413,17 +523,32 @@ Ret BackendApi::exportScorePdf(const INotationPtr notation, QIODevice& destinati
     return ok ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
+Ret BackendApi::exportScorePdf(std::future<RetVal<ByteArray> >& pdfData, BackendJsonWriter& jsonWriter, bool addSeparator)
+{
+    TRACEFUNC
+
+    RetVal<ByteArray> writerRetVal = pdfData.get();
+    if (!writerRetVal.ret) {
+        return writerRetVal.ret;
+    }
+
+    jsonWriter.addKey(PDF_WRITER_NAME.c_str());
+    jsonWriter.addBase64Value(writerRetVal.val.toQByteArrayNoCopy(), addSeparator);
+
+    return make_ret(Ret::Code::Ok);
+}
+
 Ret BackendApi::exportScoreMidi(const INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator)
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(MIDI_WRITER_NAME, notation);
+    RetVal<ByteArray> writerRetVal = processWriterData(MIDI_WRITER_NAME, notation);
     if (!writerRetVal.ret) {
         return writerRetVal.ret;
     }
 
     jsonWriter.addKey(MIDI_WRITER_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
+    jsonWriter.addBase64Value(writerRetVal.val.toQByteArrayNoCopy(), addSeparator);
 
     return make_ret(Ret::Code::Ok);
 }
@@ -432,13 +557,13 @@ Ret BackendApi::exportScoreMusicXML(const INotationPtr notation, BackendJsonWrit
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(MUSICXML_WRITER_NAME, notation);
+    RetVal<ByteArray> writerRetVal = processWriterData(MUSICXML_WRITER_NAME, notation);
     if (!writerRetVal.ret) {
         return writerRetVal.ret;
     }
 
     jsonWriter.addKey(MUSICXML_JSON_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
+    jsonWriter.addBase64Value(writerRetVal.val.toQByteArrayNoCopy(), addSeparator);
 
     return make_ret(Ret::Code::Ok);
 }
@@ -475,7 +600,65 @@ Ret BackendApi::devInfo(const notation::INotationPtr notation, BackendJsonWriter
     return make_ret(Ret::Code::Ok);
 }
 
-RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, const INotationPtr notation)
+std::future<RetVal<ByteArray> > BackendApi::schedulePdf(const INotationPtr notation)
+{
+#ifdef MUSE_THREADS_SUPPORT
+    //! NOTE The recorded pages and the writer settings are taken here, on the calling thread.
+    //! The background task only replays them, it never paints the score
+    RecordedPdf pdf;
+    pdf.painting = notation->painting();
+    pdf.pages = pdf.painting->pageDisplayLists();
+
+    if (pdf.pages) {
+        pdf.settings = iex::imagesexport::makePdfWriterSettings(*imagesExportConfiguration(), *application(),
+                                                                notation->projectWorkTitleAndPartName(),
+                                                                pdf.pages->pageSizeInch.toQSizeF());
+        pdf.transparentBackground = imagesExportConfiguration()->exportPdfWithTransparentBackground();
+
+        return std::async(std::launch::async, [pdf]() {
+            return writeRecordedPdf(pdf);
+        });
+    }
+#endif
+
+    //! NOTE Nothing recorded: written by the PDF writer on the calling thread, when the result is requested
+    return std::async(std::launch::deferred, [notation]() {
+        return processWriterData(PDF_WRITER_NAME, notation);
+    });
+}
+
+RetVal<ByteArray> BackendApi::writeRecordedPdf(const RecordedPdf& pdf)
+{
+    QByteArray qdata;
+    QBuffer buf(&qdata);
+    buf.open(QIODevice::WriteOnly);
+
+    QPdfWriter pdfWriter(&buf);
+    iex::imagesexport::preparePdfWriter(pdfWriter, pdf.settings);
+
+    Painter painter(&pdfWriter, "backendapi_pdf");
+    if (!painter.isActive()) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    INotationPainting::Options opt;
+    opt.deviceDpi = pdfWriter.logicalDpiX();
+    opt.onNewPage = [&pdfWriter]() { pdfWriter.newPage(); };
+    opt.printPageBackground = !pdf.transparentBackground;
+
+    bool replayed = pdf.painting->paintRecordedPdf(&painter, opt, pdf.pages);
+
+    painter.endDraw();
+
+    if (!replayed) {
+        LOGE() << "Failed to replay the recorded pages";
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    return RetVal<ByteArray>::make_ok(ByteArray::fromQByteArray(qdata));
+}
+
+RetVal<ByteArray> BackendApi::processWriterData(const std::string& writerName, const INotationPtr notation)
 {
     auto writer = writers()->writer(writerName);
     if (!writer) {
@@ -492,13 +675,19 @@ RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, cons
         return writeRet;
     }
 
-    RetVal<QByteArray> result;
-    result.ret = make_ret(Ret::Code::Ok);
-    result.val = data.toQByteArrayNoCopy().toBase64();
-
     device.close();
 
-    return result;
+    return RetVal<ByteArray>::make_ok(data);
+}
+
+RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, const INotationPtr notation)
+{
+    RetVal<ByteArray> data = processWriterData(writerName, notation);
+    if (!data.ret) {
+        return data.ret;
+    }
+
+    return RetVal<QByteArray>::make_ok(data.val.toQByteArrayNoCopy().toBase64());
 }
 
 RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, const INotationPtrList notations,
@@ -784,7 +973,7 @@ void BackendApi::renderExcerptsContents(IMasterNotationPtr masterNotation)
     for (const IExcerptNotationPtr& excerpt : masterNotation->excerpts()) {
         Score* score = excerpt->notation()->elements()->msScore();
         if (!score->autoLayoutEnabled()) {
-            score->doLayout();
+            score->doPendingLayout();
         }
     }
 }
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <future>
+
 #include <QFile>
 
 #include "types/retval.h"
@@ -32,7 +34,10 @@
 #include "global/iapplication.h"
 #include "io/ifilesystem.h"
 #include "project/iprojectcreator.h"
+#include "project/imscmetareader.h"
 #include "project/inotationwritersregister.h"
+#include "importexport/imagesexport/iimagesexportconfiguration.h"
+#include "importexport/imagesexport/pdfwritersettings.h"
 
 #include "converter/convertertypes.h"
 
@@ -48,6 +53,8 @@ class BackendApi
     inline static muse::GlobalInject<muse::IApplication> application;
     inline static muse::GlobalInject<project::IProjectCreator> notationCreator;
     inline static muse::GlobalInject<project::INotationWritersRegister> writers;
+    inline static muse::GlobalInject<project::IMscMetaReader> mscMetaReader;
+    inline static muse::GlobalInject<iex::imagesexport::IImagesExportConfiguration> imagesExportConfiguration;
 
 public:
     static muse::Ret exportScoreMedia(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& highlightConfigPath,
@@ -62,6 +69,8 @@ public:
 
     static muse::Ret updateSource(const muse::io::path_t& in, const std::string& newSource, bool forceMode = false);
 
+    static muse::Ret probeScores(const std::vector<muse::io::path_t>& ins, const muse::io::path_t& out, int workers = 0);
+
 private:
     static muse::Ret openOutputFile(QFile& file, const muse::io::path_t& out);
 
@@ -77,11 +86,24 @@ private:
                                                   BackendJsonWriter& jsonWriter, bool addSeparator = false);
     static muse::Ret exportScorePdf(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
     static muse::Ret exportScorePdf(const notation::INotationPtr notation, QIODevice& destinationDevice);
+    static muse::Ret exportScorePdf(std::future<muse::RetVal<muse::ByteArray> >& pdfData, BackendJsonWriter& jsonWriter,
+                                    bool addSeparator = false);
     static muse::Ret exportScoreMidi(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
     static muse::Ret exportScoreMusicXML(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
     static muse::Ret exportScoreMetaData(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
     static muse::Ret devInfo(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
 
+    //! NOTE Everything needed to write the PDF from the recorded pages, taken on the calling thread
+    struct RecordedPdf {
+        notation::INotationPaintingPtr painting;
+        notation::INotationPainting::PageDisplayListsPtr pages;
+        iex::imagesexport::PdfWriterSettings settings;
+        bool transparentBackground = false;
+    };
+
+    static std::future<muse::RetVal<muse::ByteArray> > schedulePdf(const notation::INotationPtr notation);
+    static muse::RetVal<muse::ByteArray> writeRecordedPdf(const RecordedPdf& pdf);
+    static muse::RetVal<muse::ByteArray> processWriterData(const std::string& writerName, const notation::INotationPtr notation);
     static muse::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtr notation);
     static muse::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtrList notations,
                                                   const project::INotationWriter::Options& options);
@@ -94,6 +116,8 @@ private:
 
     static muse::Ret doExportScoreElements(const notation::INotationPtr notation, QIODevice& out);
 
+    static QByteArray probeJsonLine(std::shared_ptr<project::IMscMetaReader> metaReader, const muse::io::path_t& in);
+
     static muse::RetVal<QByteArray> scorePartJson(mu::engraving::Score* score, const std::string& fileName);
 
     static void switchToPageView(notation::IMasterNotationPtr masterNotation);
@@ -21,10 +21,15 @@
  */
 #include "backendjsonwriter.h"
 
+#include <algorithm>
+
 #include <QIODevice>
 
 using namespace mu::converter;
 
+//! NOTE A multiple of 3, so every chunk except the last one is encoded without padding
+static constexpr qsizetype BASE64_CHUNK_SIZE = 3 * 16 * 1024;
+
 BackendJsonWriter::BackendJsonWriter(QIODevice* destinationDevice)
 {
     m_destinationDevice = destinationDevice;
@@ -59,6 +64,21 @@ void BackendJsonWriter::addValue(const QByteArray& data, bool addSeparator, bool
     }
 }
 
+void BackendJsonWriter::addBase64Value(const QByteArray& data, bool addSeparator)
+{
+    m_destinationDevice->write("\"");
+
+    for (qsizetype pos = 0; pos < data.size(); pos += BASE64_CHUNK_SIZE) {
+        const qsizetype chunkSize = std::min(BASE64_CHUNK_SIZE, data.size() - pos);
+        m_destinationDevice->write(QByteArray::fromRawData(data.constData() + pos, chunkSize).toBase64());
+    }
+
+    m_destinationDevice->write("\"");
+    if (addSeparator) {
+        m_destinationDevice->write(",\n");
+    }
+}
+
 void BackendJsonWriter::openArray()
 {
     m_destinationDevice->write(" [");
@@ -36,6 +36,10 @@ public:
     void addKey(const char* arrayName);
     void addValue(const QByteArray& data, bool addSeparator = false, bool isJson = false);
 
+    //! NOTE Writes the data as a base64 string. The data is encoded chunk by chunk
+    //! straight into the device, so the encoded copy is never held in memory as a whole
+    void addBase64Value(const QByteArray& data, bool addSeparator = false);
+
     void openArray();
     void closeArray(bool addSeparator = false);
 
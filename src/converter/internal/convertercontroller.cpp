@@ -25,6 +25,11 @@
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QProcess>
+#include <QTemporaryDir>
 
 #include "global/defer.h"
 #include "global/io/buffer.h"
@@ -51,10 +56,49 @@ static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
 static const std::string SVG_SUFFIX = "svg";
 static const std::string MP3_SUFFIX = "mp3";
+static const std::string WAV_SUFFIX = "wav";
+static const std::string OGG_SUFFIX = "ogg";
+static const std::string FLAC_SUFFIX = "flac";
+static const std::string AAC_SUFFIX = "aac";
+
+//! NOTE A single page or a region of the score only needs the layout up to it.
+//! It's used only if every output is written for the target (parts outputs, MusicXML etc. need the whole layout)
+static void limitLayoutToTarget(OpenParams& params, const std::vector<path_t>& outs, const std::optional<ConvertTarget>& target)
+{
+    if (!target.has_value()) {
+        return;
+    }
+
+    const bool isPageTarget = std::holds_alternative<page_num_t>(target.value());
+
+    for (const path_t& out : outs) {
+        if (ConverterUtils::isPartsOut(out)) {
+            return;
+        }
+
+        const std::string suffix = io::suffix(out);
+        const bool isMuseScoreFile = suffix == engraving::MSCZ || suffix == engraving::MSCX || suffix == engraving::MSCS;
+        const bool isPageFile = suffix == PDF_SUFFIX || suffix == PNG_SUFFIX || suffix == SVG_SUFFIX;
+
+        if (!isMuseScoreFile && !(isPageTarget && isPageFile)) {
+            return;
+        }
+    }
+
+    if (isPageTarget) {
+        params.layoutPageCount = std::get<page_num_t>(target.value()) + 1;
+        return;
+    }
+
+    RetVal<ConvertRegion> region = ConverterUtils::parseRegion(std::get<ConvertRegionJson>(target.value()));
+    if (region.ret && region.val.end.measureIdx != muse::nidx) {
+        params.layoutMeasureCount = region.val.end.measureIdx + 1;
+    }
+}
 
 Ret ConverterController::batchConvert(const path_t& batchJobFile, const OpenParams& openParams,
                                       const String& soundProfile, const UriQuery& extensionUri,
-                                      ProgressPtr progress)
+                                      const BatchParams& batchParams, ProgressPtr progress)
 {
     TRACEFUNC;
 
@@ -71,22 +115,58 @@ Ret ConverterController::batchConvert(const path_t& batchJobFile, const OpenPara
         return batchJob.ret;
     }
 
-    StringList errors;
+    QElapsedTimer batchTimer;
+    batchTimer.start();
 
-    int64_t current = 0;
-    int64_t total = batchJob.val.size();
-    for (const Job& job : batchJob.val) {
-        if (progress) {
-            ++current;
-            progress->progress(current, total, job.in.toStdString());
+    std::vector<JobReport> reports;
+
+    if (batchParams.workers > 1 && batchJob.val.size() > 1) {
+        reports = batchConvertInWorkers(batchJob.val, batchParams.workers, progress);
+    } else {
+        int64_t current = 0;
+        int64_t total = batchJob.val.size();
+        for (const Job& job : batchJob.val) {
+            if (progress) {
+                ++current;
+                progress->progress(current, total, job.in.toStdString());
+            }
+
+            JobReport report;
+            report.in = job.in;
+            report.outs = job.outs;
+
+            ConverterUtils::resetPeakMemoryUsage();
+            QElapsedTimer jobTimer;
+            jobTimer.start();
+
+            //! NOTE All outputs of a job are written from a single loaded project
+            report.ret = convertFile(job.in, job.outs, openParams, soundProfile, job.tracksDiffPath, extensionUri, job.transposeOptions,
+                                     job.pageNum, job.visibleParts,
+                                     job.copyright);
+
+            report.durationMs = jobTimer.elapsed();
+            report.peakMemoryBytes = ConverterUtils::peakMemoryUsage();
+            reports.push_back(std::move(report));
         }
+    }
+
+    StringList errors;
+    for (const JobReport& report : reports) {
+        if (!report.ret) {
+            StringList outs;
+            for (const path_t& out : report.outs) {
+                outs.push_back(out.toString());
+            }
 
-        Ret ret = convertFile(job.in, job.out, openParams, soundProfile, job.tracksDiffPath, extensionUri, job.transposeOptions,
-                              job.pageNum, job.visibleParts,
-                              job.copyright);
-        if (!ret) {
             errors.emplace_back(String(u"failed convert, err: %1, in: %2, out: %3")
-                                .arg(String::fromStdString(ret.toString())).arg(job.in.toString()).arg(job.out.toString()));
+                                .arg(String::fromStdString(report.ret.toString())).arg(report.in.toString()).arg(outs.join(u", ")));
+        }
+    }
+
+    if (!batchParams.reportPath.empty()) {
+        Ret reportRet = writeBatchReport(reports, std::max(batchParams.workers, 1), batchTimer.elapsed(), batchParams.reportPath);
+        if (!reportRet) {
+            LOGE() << "failed write batch report, err: " << reportRet.toString() << ", path: " << batchParams.reportPath;
         }
     }
 
@@ -104,6 +184,159 @@ Ret ConverterController::batchConvert(const path_t& batchJobFile, const OpenPara
     return ret;
 }
 
+std::vector<ConverterController::JobReport> ConverterController::batchConvertInWorkers(const BatchJob& batchJob, int workers,
+                                                                                        ProgressPtr progress)
+{
+    TRACEFUNC;
+
+    //! NOTE The engraving model is not thread-safe, so every worker is a separate process
+    //! converting its share of the jobs with its own project, notation and context.
+    //! The jobs are scheduled largest-first (by input file size) on the least loaded worker.
+    std::vector<size_t> order(batchJob.size());
+    std::vector<qint64> sizes(batchJob.size());
+    for (size_t i = 0; i < batchJob.size(); ++i) {
+        order[i] = i;
+        sizes[i] = QFileInfo(batchJob[i].in.toQString()).size();
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&sizes](size_t i1, size_t i2) {
+        return sizes[i1] > sizes[i2];
+    });
+
+    const size_t workerCount = std::min(static_cast<size_t>(workers), batchJob.size());
+    std::vector<std::vector<size_t> > workerJobs(workerCount);
+    std::vector<qint64> workerLoad(workerCount, 0);
+    for (size_t jobIdx : order) {
+        size_t workerIdx = std::min_element(workerLoad.cbegin(), workerLoad.cend()) - workerLoad.cbegin();
+        workerJobs[workerIdx].push_back(jobIdx);
+        workerLoad[workerIdx] += std::max<qint64>(sizes[jobIdx], 1);
+    }
+
+    std::vector<JobReport> reports(batchJob.size());
+    for (size_t i = 0; i < batchJob.size(); ++i) {
+        reports[i].in = batchJob[i].in;
+        reports[i].outs = batchJob[i].outs;
+        reports[i].ret = make_ret(Err::ConvertFailed, "worker process failed");
+    }
+
+    QTemporaryDir tempDir;
+    if (!tempDir.isValid()) {
+        LOGE() << "failed create temporary dir for batch workers";
+        return reports;
+    }
+
+    //! NOTE A worker runs with the options of this process (style, resolution, trim, import options etc.),
+    //! only the job file and the report are its own
+    const QStringList arguments = QCoreApplication::arguments();
+
+    std::vector<std::unique_ptr<QProcess> > processes;
+    std::vector<QString> reportPaths;
+
+    for (size_t w = 0; w < workerCount; ++w) {
+        QJsonArray workerBatch;
+        for (size_t jobIdx : workerJobs[w]) {
+            workerBatch.append(batchJob[jobIdx].source);
+        }
+
+        const QString batchPath = tempDir.filePath(QString("batch-%1.json").arg(w));
+        const QString reportPath = tempDir.filePath(QString("report-%1.json").arg(w));
+
+        QByteArray batchData = QJsonDocument(workerBatch).toJson(QJsonDocument::Compact);
+        Ret ret = File::writeFile(batchPath, ByteArray::fromQByteArrayNoCopy(batchData));
+        if (!ret) {
+            LOGE() << "failed write worker batch file, err: " << ret.toString();
+            processes.push_back(nullptr);
+            reportPaths.push_back(QString());
+            continue;
+        }
+
+        const QStringList args = ConverterUtils::batchWorkerArguments(arguments, batchPath, reportPath);
+
+        auto process = std::make_unique<QProcess>();
+        process->setProcessChannelMode(QProcess::ForwardedChannels);
+        process->start(QCoreApplication::applicationFilePath(), args);
+
+        processes.push_back(std::move(process));
+        reportPaths.push_back(reportPath);
+    }
+
+    int64_t current = 0;
+    int64_t total = batchJob.size();
+
+    for (size_t w = 0; w < workerCount; ++w) {
+        QProcess* process = processes[w].get();
+        if (!process) {
+            continue;
+        }
+
+        process->waitForFinished(-1);
+        if (process->exitStatus() != QProcess::NormalExit) {
+            LOGE() << "batch worker " << w << " crashed";
+        }
+
+        //! NOTE A worker exits with an error code if any of its jobs failed,
+        //! the per-job results are taken from its report
+        ByteArray reportData;
+        Ret ret = File::readFile(reportPaths[w], reportData);
+        QJsonArray jobsArray;
+        if (ret) {
+            jobsArray = QJsonDocument::fromJson(reportData.toQByteArrayNoCopy()).object().value("jobs").toArray();
+        } else {
+            LOGE() << "failed read batch worker report, err: " << ret.toString();
+        }
+
+        const std::vector<size_t>& jobs = workerJobs[w];
+        for (size_t i = 0; i < jobs.size() && i < static_cast<size_t>(jobsArray.size()); ++i) {
+            const QJsonObject jobObj = jobsArray.at(static_cast<int>(i)).toObject();
+            JobReport& report = reports[jobs[i]];
+            report.ret = jobObj.value("success").toBool()
+                         ? make_ok()
+                         : make_ret(Err::ConvertFailed, jobObj.value("error").toString().toStdString());
+            report.durationMs = static_cast<int64_t>(jobObj.value("durationMs").toDouble());
+            report.peakMemoryBytes = static_cast<uint64_t>(jobObj.value("peakMemoryBytes").toDouble());
+        }
+
+        if (progress) {
+            current += jobs.size();
+            progress->progress(current, total, "");
+        }
+    }
+
+    return reports;
+}
+
+Ret ConverterController::writeBatchReport(const std::vector<JobReport>& reports, int workers, int64_t durationMs,
+                                          const muse::io::path_t& path) const
+{
+    QJsonArray jobsArray;
+    for (const JobReport& report : reports) {
+        QJsonArray outArray;
+        for (const path_t& out : report.outs) {
+            outArray.append(out.toQString());
+        }
+
+        QJsonObject jobObj;
+        jobObj["in"] = report.in.toQString();
+        jobObj["out"] = outArray;
+        jobObj["success"] = report.ret.success();
+        if (!report.ret) {
+            jobObj["error"] = QString::fromStdString(report.ret.toString());
+        }
+        jobObj["durationMs"] = static_cast<qint64>(report.durationMs);
+        jobObj["peakMemoryBytes"] = static_cast<qint64>(report.peakMemoryBytes);
+
+        jobsArray.append(jobObj);
+    }
+
+    QJsonObject root;
+    root["workers"] = workers;
+    root["durationMs"] = static_cast<qint64>(durationMs);
+    root["jobs"] = jobsArray;
+
+    QByteArray qJson = QJsonDocument(root).toJson(QJsonDocument::Indented);
+    return File::writeFile(path, ByteArray::fromQByteArrayNoCopy(qJson));
+}
+
 Ret ConverterController::fileConvert(const path_t& in, const path_t& out,
                                      const OpenParams& openParams,
                                      const String& soundProfile,
@@ -123,10 +356,10 @@ Ret ConverterController::fileConvert(const path_t& in, const path_t& out,
         transposeOptions = transposeOptionsRet.val;
     }
 
-    return convertFile(in, out, openParams, soundProfile, tracksDiffPath, extensionUri, transposeOptions, target);
+    return convertFile(in, { out }, openParams, soundProfile, tracksDiffPath, extensionUri, transposeOptions, target);
 }
 
-Ret ConverterController::convertFile(const muse::io::path_t& in, const muse::io::path_t& out,
+Ret ConverterController::convertFile(const muse::io::path_t& in, const std::vector<muse::io::path_t>& outs,
                                      const OpenParams& openParams,
                                      const String& soundProfile,
                                      const path_t& tracksDiffPath,
@@ -138,13 +371,16 @@ Ret ConverterController::convertFile(const muse::io::path_t& in, const muse::io:
 {
     TRACEFUNC;
 
-    LOGI() << "in: " << in << ", out: " << out;
+    IF_ASSERT_FAILED(!outs.empty()) {
+        return make_ret(Err::UnknownError);
+    }
 
-    std::string suffix = io::suffix(out);
+    for (const path_t& out : outs) {
+        LOGI() << "in: " << in << ", out: " << out;
 
-    auto writer = writers()->writer(suffix);
-    if (!writer) {
-        return make_ret(Err::ConvertTypeUnknown);
+        if (!writers()->writer(io::suffix(out))) {
+            return make_ret(Err::ConvertTypeUnknown);
+        }
     }
 
     auto notationProject = notationCreator()->newProject(iocContext());
@@ -152,7 +388,12 @@ Ret ConverterController::convertFile(const muse::io::path_t& in, const muse::io:
         return make_ret(Err::UnknownError);
     }
 
-    Ret ret = notationProject->load(in, openParams);
+    OpenParams params = openParams;
+    if (!extensionUri.isValid()) {
+        limitLayoutToTarget(params, outs, target);
+    }
+
+    Ret ret = notationProject->load(in, params);
     if (!ret) {
         LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
         return make_ret(Err::InFileFailedLoad);
@@ -196,15 +437,71 @@ Ret ConverterController::convertFile(const muse::io::path_t& in, const muse::io:
         globalContext()->setCurrentProject(nullptr);
     };
 
+    const ConverterUtils::JobOutputs jobOuts = ConverterUtils::splitJobOutputs(outs, [this](const std::string& suffix) {
+        return isAudioSuffix(suffix);
+    });
+
+    //! NOTE The parts outputs are written first, before the extension (if any) can modify the notation,
+    //! so they are written without it
+    for (const path_t& out : jobOuts.partsOuts) {
+        Ret outRet = convertOutput(notationProject, out, false /*byExtension*/, target);
+        if (!outRet) {
+            ret = outRet;
+        }
+    }
+
+    if (!jobOuts.audioPartsOuts.empty()) {
+        Ret outRet = convertScorePartsToAudio(notationProject->masterNotation(), jobOuts.audioPartsOuts);
+        if (!outRet) {
+            ret = outRet;
+        }
+    }
+
+    // use a extension for convert
+    //! NOTE The extension can modify the notation (score), so it is performed once for all the score outputs
+    if (extensionUri.isValid() && !jobOuts.scoreOuts.empty()) {
+        Ret extensionRet = extensionsProvider()->perform(extensionUri);
+        if (!extensionRet) {
+            LOGE() << "Failed to convert by extension, err: " << extensionRet.toString();
+            return extensionRet;
+        }
+    }
+
+    for (const path_t& out : jobOuts.scoreOuts) {
+        Ret outRet = convertOutput(notationProject, out, extensionUri.isValid(), target);
+        if (!outRet) {
+            ret = outRet;
+        }
+    }
+
+    if (ret && !tracksDiffPath.empty()) {
+        ret = writeTracksDiff(notationProject, oldTracks, tracksDiffPath);
+    }
+
+    return ret;
+}
+
+Ret ConverterController::convertOutput(INotationProjectPtr notationProject, const muse::io::path_t& out, bool byExtension,
+                                       const std::optional<ConvertTarget>& target)
+{
+    std::string suffix = io::suffix(out);
+
+    auto writer = writers()->writer(suffix);
+    if (!writer) {
+        return make_ret(Err::ConvertTypeUnknown);
+    }
+
     // Check if this is a part conversion job
     QString baseName = QString::fromStdString(io::completeBasename(out).toStdString());
     if (baseName.contains('*')) {
         return convertScoreParts(writer, notationProject->masterNotation(), out);
     }
 
+    Ret ret;
+
     // use a extension for convert
-    if (extensionUri.isValid()) {
-        ret = convertByExtension(writer, notationProject->masterNotation()->notation(), out, extensionUri);
+    if (byExtension) {
+        ret = convertByExtension(writer, notationProject->masterNotation()->notation(), out);
         if (!ret) {
             LOGE() << "Failed to convert by extension, err: " << ret.toString();
         }
@@ -221,7 +518,9 @@ Ret ConverterController::convertFile(const muse::io::path_t& in, const muse::io:
                 return saveRegion(notationProject, std::get<ConvertRegionJson>(target.value()), out);
             }
 
-            return notationProject->save(out);
+            //! NOTE Saved as a copy: a plain save would switch the project path to this output,
+            //! and the header and footer macros of the outputs written after it would read that path
+            return notationProject->save(out, SaveMode::SaveCopy);
         }
 
         if (pageNumIsSet || isConvertPageByPage(suffix)) {
@@ -243,10 +542,6 @@ Ret ConverterController::convertFile(const muse::io::path_t& in, const muse::io:
         }
     }
 
-    if (ret && !tracksDiffPath.empty()) {
-        ret = writeTracksDiff(notationProject, oldTracks, tracksDiffPath);
-    }
-
     return ret;
 }
 
@@ -284,8 +579,8 @@ Ret ConverterController::convertScoreParts(INotationWriterPtr writer, IMasterNot
         return convertScorePartsToPdf(writer, masterNotation, out);
     } else if (suffix == PNG_SUFFIX) {
         return convertScorePartsToPngs(writer, masterNotation, out);
-    } else if (suffix == MP3_SUFFIX) {
-        return convertScorePartsToMp3(writer, masterNotation, out);
+    } else if (isAudioSuffix(suffix)) {
+        return convertScorePartsToAudio(masterNotation, { out });
     }
 
     return make_ret(Ret::Code::NotSupported);
@@ -319,6 +614,7 @@ RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(const m
 
     for (const auto obj : arr) {
         Job job;
+        job.source = obj.toObject();
         job.in = correctUserInputPath(obj[u"in"].toString());
 
         QJsonObject transposeOptionsObj = obj[u"transpose"].toObject();
@@ -381,42 +677,37 @@ RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(const m
 
         const QJsonValue outValue = obj[u"out"];
         if (outValue.isString()) {
-            job.out = correctUserInputPath(outValue.toString());
-            rv.val.push_back(std::move(job));
+            job.outs.push_back(correctUserInputPath(outValue.toString()));
         } else if (outValue.isArray()) {
             const QJsonArray outArray = outValue.toArray();
             for (const auto outItem : outArray) {
-                Job partJob = job; // Copy the input path
                 if (outItem.isString()) {
-                    partJob.out = correctUserInputPath(outItem.toString());
+                    job.outs.push_back(correctUserInputPath(outItem.toString()));
                 } else if (outItem.isArray() && outItem.toArray().size() == 2) {
                     const QJsonArray partOutArray = outItem.toArray();
                     const QString prefix = correctUserInputPath(partOutArray[0].toString());
                     const QString suffix = partOutArray[1].toString();
-                    partJob.out = prefix + "*" + suffix; // Use "*" as a placeholder for part names
+                    job.outs.push_back(prefix + "*" + suffix); // Use "*" as a placeholder for part names
                 }
-                rv.val.push_back(std::move(partJob));
             }
         }
+
+        if (!job.outs.empty()) {
+            rv.val.push_back(std::move(job));
+        }
     }
 
     rv.ret = make_ret(Ret::Code::Ok);
     return rv;
 }
 
-Ret ConverterController::convertByExtension(INotationWriterPtr writer, INotationPtr notation, const muse::io::path_t& out,
-                                            const muse::UriQuery& extensionUri)
+Ret ConverterController::convertByExtension(INotationWriterPtr writer, INotationPtr notation, const muse::io::path_t& out)
 {
-    //! NOTE First we do the extension, it can modify the notation (score)
-    Ret ret = extensionsProvider()->perform(extensionUri);
-    if (!ret) {
-        return ret;
-    }
-
+    //! NOTE The extension has already been performed, see convertFile
     auto outBuf = Buffer::opened(IODevice::WriteOnly);
 
     outBuf.setMeta("file_path", out.toStdString());
-    ret = writer->write(notation, outBuf);
+    Ret ret = writer->write(notation, outBuf);
     if (!ret) {
         LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
         return make_ret(Err::OutFileFailedWrite);
@@ -432,6 +723,19 @@ Ret ConverterController::convertByExtension(INotationWriterPtr writer, INotation
     return make_ret(Ret::Code::Ok);
 }
 
+bool ConverterController::isAudioSuffix(const std::string& suffix) const
+{
+    static const std::unordered_set<std::string> TYPES {
+        WAV_SUFFIX,
+        MP3_SUFFIX,
+        OGG_SUFFIX,
+        FLAC_SUFFIX,
+        AAC_SUFFIX,
+    };
+
+    return muse::contains(TYPES, suffix);
+}
+
 bool ConverterController::isConvertPageByPage(const std::string& suffix) const
 {
     static const std::unordered_set<std::string> TYPES {
@@ -562,8 +866,7 @@ Ret ConverterController::convertScorePartsToPngs(INotationWriterPtr writer, mu::
     return make_ret(Ret::Code::Ok);
 }
 
-Ret ConverterController::convertScorePartsToMp3(INotationWriterPtr writer, IMasterNotationPtr masterNotation,
-                                                const muse::io::path_t& out) const
+Ret ConverterController::convertScorePartsToAudio(IMasterNotationPtr masterNotation, const std::vector<muse::io::path_t>& outs) const
 {
     TRACEFUNC;
 
@@ -571,25 +874,53 @@ Ret ConverterController::convertScorePartsToMp3(INotationWriterPtr writer, IMast
         { INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::PER_PART) },
     };
 
+    struct AudioOut {
+        INotationWriterPtr writer;
+        QString dirPath;
+        QString baseName;
+        std::string suffix;
+    };
+
+    std::vector<AudioOut> audioOuts;
+    for (const muse::io::path_t& out : outs) {
+        AudioOut audioOut;
+        audioOut.suffix = io::suffix(out);
+        audioOut.writer = writers()->writer(audioOut.suffix);
+        if (!audioOut.writer) {
+            return make_ret(Err::ConvertTypeUnknown);
+        }
+
+        audioOut.dirPath = io::dirpath(out).toQString();
+        audioOut.baseName = QString::fromStdString(io::completeBasename(out).toStdString());
+        audioOuts.push_back(std::move(audioOut));
+    }
+
+    //! NOTE Every write sets the part as the playback notation, renders it and restores the previous one:
+    //! the render and the encoding are a single IPlayback::saveSoundTrack call, so it is not shared between
+    //! formats. Only the loaded and laid out project is shared.
     for (const IExcerptNotationPtr& e : masterNotation->excerpts()) {
         QString partName = e->notation()->name();
-        QString baseName = QString::fromStdString(io::completeBasename(out).toStdString());
-        muse::io::path_t partOut = io::dirpath(out) + "/" + baseName.replace("*", partName).toStdString() + ".mp3";
 
-        auto outBuf = Buffer::opened(IODevice::WriteOnly);
+        for (const AudioOut& audioOut : audioOuts) {
+            QString baseName = audioOut.baseName;
+            muse::io::path_t partOut = audioOut.dirPath + "/" + baseName.replace("*", partName) + "."
+                                       + QString::fromStdString(audioOut.suffix);
 
-        outBuf.setMeta("file_path", partOut.toStdString());
-        Ret ret = writer->write(e->notation(), outBuf, options);
-        if (!ret) {
-            LOGE() << "failed write, err: " << ret.toString() << ", path: " << partOut;
-            return make_ret(Err::OutFileFailedWrite);
-        }
+            auto outBuf = Buffer::opened(IODevice::WriteOnly);
 
-        outBuf.close();
-        ret = File::writeFile(partOut, outBuf.data());
-        if (!ret) {
-            LOGE() << "failed to write file: " << ret.toString();
-            return make_ret(Err::OutFileFailedWrite);
+            outBuf.setMeta("file_path", partOut.toStdString());
+            Ret ret = audioOut.writer->write(e->notation(), outBuf, options);
+            if (!ret) {
+                LOGE() << "failed write, err: " << ret.toString() << ", path: " << partOut;
+                return make_ret(Err::OutFileFailedWrite);
+            }
+
+            outBuf.close();
+            ret = File::writeFile(partOut, outBuf.data());
+            if (!ret) {
+                LOGE() << "failed to write file: " << ret.toString();
+                return make_ret(Err::OutFileFailedWrite);
+            }
         }
     }
 
@@ -622,6 +953,8 @@ muse::Ret ConverterController::saveRegion(INotationProjectPtr project, const Con
 
     INotationInteractionPtr interaction = notation->interaction();
 
+    std::vector<std::pair<mu::engraving::VoicesSelectionFilterTypes, bool> > oldVoiceFilters;
+
     if (!region.val.voiceIdxSet.empty()) {
         using VoiceFilterType = mu::engraving::VoicesSelectionFilterTypes;
         const std::vector<std::pair<size_t, mu::engraving::VoicesSelectionFilterTypes> > VOICE_FILTERS {
@@ -633,6 +966,7 @@ muse::Ret ConverterController::saveRegion(INotationProjectPtr project, const Con
 
         for (const auto& pair : VOICE_FILTERS) {
             const bool voiceAccepted = muse::contains(region.val.voiceIdxSet, pair.first);
+            oldVoiceFilters.emplace_back(pair.second, interaction->selectionFilter()->isSelectionTypeFiltered(pair.second));
             interaction->selectionFilter()->setSelectionTypeFiltered(pair.second, voiceAccepted);
         }
     }
@@ -640,6 +974,14 @@ muse::Ret ConverterController::saveRegion(INotationProjectPtr project, const Con
     interaction->select({ startMeasure }, SelectType::RANGE, region.val.start.staffIdx);
     interaction->select({ endMeasure }, SelectType::RANGE, region.val.end.staffIdx);
 
+    //! NOTE The other outputs of the job are written from the same project, so they must not see the region
+    DEFER {
+        interaction->clearSelection();
+        for (const auto& [voiceFilter, filtered] : oldVoiceFilters) {
+            interaction->selectionFilter()->setSelectionTypeFiltered(voiceFilter, filtered);
+        }
+    };
+
     return project->save(out, SaveMode::SaveSelection);
 }
 
@@ -745,3 +1087,10 @@ Ret ConverterController::updateSource(const muse::io::path_t& in, const std::str
 
     return BackendApi::updateSource(in, newSource, forceMode);
 }
+
+Ret ConverterController::probeScores(const std::vector<muse::io::path_t>& ins, const muse::io::path_t& out, int workers)
+{
+    TRACEFUNC;
+
+    return BackendApi::probeScores(ins, out, workers);
+}
@@ -23,6 +23,8 @@
 
 #include <vector>
 
+#include <QJsonObject>
+
 #include "../iconvertercontroller.h"
 
 #include "modularity/ioc.h"
@@ -51,7 +53,8 @@ public:
                           const std::optional<ConvertTarget>& target = std::nullopt) override;
 
     muse::Ret batchConvert(const muse::io::path_t& batchJobFile, const OpenParams& openParams = {}, const muse::String& soundProfile = {},
-                           const muse::UriQuery& extensionUri = {}, muse::ProgressPtr progress = nullptr) override;
+                           const muse::UriQuery& extensionUri = {}, const BatchParams& batchParams = {},
+                           muse::ProgressPtr progress = nullptr) override;
 
     muse::Ret convertScoreParts(const muse::io::path_t& in, const muse::io::path_t& out, const OpenParams& openParams = {}) override;
 
@@ -70,6 +73,8 @@ public:
 
     muse::Ret updateSource(const muse::io::path_t& in, const std::string& newSource, bool forceMode = false) override;
 
+    muse::Ret probeScores(const std::vector<muse::io::path_t>& ins, const muse::io::path_t& out, int workers = 0) override;
+
 private:
     struct CopyrightInfo {
         CopyrightInfo() {}
@@ -80,12 +85,22 @@ private:
 
     struct Job {
         muse::io::path_t in;
-        muse::io::path_t out;
+        std::vector<muse::io::path_t> outs;
         muse::io::path_t tracksDiffPath;
         std::optional<notation::TransposeOptions> transposeOptions;
         std::optional<size_t> pageNum;
         std::vector<size_t> visibleParts;
         CopyrightInfo copyright;
+
+        QJsonObject source; // the job as given in the batch job file
+    };
+
+    struct JobReport {
+        muse::io::path_t in;
+        std::vector<muse::io::path_t> outs;
+        muse::Ret ret;
+        int64_t durationMs = 0;
+        uint64_t peakMemoryBytes = 0;
     };
 
     using BatchJob = std::vector<Job>;
@@ -93,17 +108,23 @@ private:
 
     muse::RetVal<BatchJob> parseBatchJob(const muse::io::path_t& batchJobFile) const;
 
-    muse::Ret convertFile(const muse::io::path_t& in, const muse::io::path_t& out, const OpenParams& openParams = {},
+    std::vector<JobReport> batchConvertInWorkers(const BatchJob& batchJob, int workers, muse::ProgressPtr progress);
+    muse::Ret writeBatchReport(const std::vector<JobReport>& reports, int workers, int64_t durationMs,
+                               const muse::io::path_t& path) const;
+
+    muse::Ret convertFile(const muse::io::path_t& in, const std::vector<muse::io::path_t>& outs, const OpenParams& openParams = {},
                           const muse::String& soundProfile = {}, const muse::io::path_t& tracksDiffPath = {},
                           const muse::UriQuery& extensionUri = {}, const TransposeOpts& transposeOptions = std::nullopt,
                           const std::optional<ConvertTarget>& target = std::nullopt, const std::vector<size_t>& visibleParts = {},
                           const CopyrightInfo& copyright = {});
+    muse::Ret convertOutput(project::INotationProjectPtr notationProject, const muse::io::path_t& out, bool byExtension,
+                            const std::optional<ConvertTarget>& target);
 
     muse::Ret convertScoreParts(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
                                 const muse::io::path_t& out);
 
-    muse::Ret convertByExtension(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out,
-                                 const muse::UriQuery& extensionUri);
+    muse::Ret convertByExtension(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out);
+    bool isAudioSuffix(const std::string& suffix) const;
     bool isConvertPageByPage(const std::string& suffix) const;
     muse::Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out) const;
     muse::Ret convertPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const size_t pageNum,
@@ -115,8 +136,7 @@ private:
                                      const muse::io::path_t& out) const;
     muse::Ret convertScorePartsToPngs(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
                                       const muse::io::path_t& out) const;
-    muse::Ret convertScorePartsToMp3(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
-                                     const muse::io::path_t& out) const;
+    muse::Ret convertScorePartsToAudio(notation::IMasterNotationPtr masterNotation, const std::vector<muse::io::path_t>& outs) const;
 
     muse::Ret saveRegion(project::INotationProjectPtr project, const ConvertRegionJson& regionJson, const muse::io::path_t& out) const;
 
@@ -21,8 +21,21 @@
  */
 #include "converterutils.h"
 
+#include <algorithm>
+
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QtGlobal>
+
+#if defined(Q_OS_LINUX)
+#include <fstream>
+#include <string>
+#elif defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
 
 #include "async/notifylist.h"
 
@@ -203,3 +216,105 @@ void ConverterUtils::setVisibleParts(const INotationPtr notation, const std::vec
         parts->setPartVisible(p->id(), muse::contains(visiblePartIds, p->id()));
     }
 }
+
+bool ConverterUtils::isPartsOut(const io::path_t& out)
+{
+    return io::completeBasename(out).toString().contains(u'*');
+}
+
+ConverterUtils::JobOutputs ConverterUtils::splitJobOutputs(const std::vector<io::path_t>& outs,
+                                                           const std::function<bool(const std::string& suffix)>& isAudioSuffix)
+{
+    JobOutputs result;
+
+    for (const io::path_t& out : outs) {
+        if (!isPartsOut(out)) {
+            result.scoreOuts.push_back(out);
+        } else if (isAudioSuffix(io::suffix(out))) {
+            result.audioPartsOuts.push_back(out);
+        } else {
+            result.partsOuts.push_back(out);
+        }
+    }
+
+    return result;
+}
+
+QStringList ConverterUtils::batchWorkerArguments(const QStringList& arguments, const QString& jobPath, const QString& reportPath)
+{
+    static const QStringList BATCH_OPTIONS { "-j", "--job", "--batch-workers", "--batch-report" };
+
+    QStringList result;
+    QStringList positional;
+
+    for (int i = 1; i < arguments.size(); ++i) {
+        const QString& arg = arguments.at(i);
+
+        //! NOTE Everything after "--" is positional
+        if (arg == "--") {
+            positional = arguments.mid(i);
+            break;
+        }
+
+        if (BATCH_OPTIONS.contains(arg)) {
+            ++i; // skip the value
+            continue;
+        }
+
+        const bool isBatchOptionWithValue = std::any_of(BATCH_OPTIONS.cbegin(), BATCH_OPTIONS.cend(), [&arg](const QString& option) {
+            return arg.startsWith(option + "=");
+        });
+
+        //! NOTE "-jfile" is "-j file"
+        const bool isCompactedJob = arg.startsWith("-j") && !arg.startsWith("--");
+
+        if (isBatchOptionWithValue || isCompactedJob) {
+            continue;
+        }
+
+        result << arg;
+    }
+
+    result << "-j" << jobPath << "--batch-report" << reportPath << positional;
+
+    return result;
+}
+
+uint64_t ConverterUtils::peakMemoryUsage()
+{
+#if defined(Q_OS_LINUX)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::stoull(line.substr(6)) * 1024; // kB
+        }
+    }
+    return 0;
+#elif defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(Q_OS_MACOS)
+    return static_cast<uint64_t>(usage.ru_maxrss); // bytes
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024; // kB
+#endif
+#endif
+}
+
+void ConverterUtils::resetPeakMemoryUsage()
+{
+#if defined(Q_OS_LINUX)
+    //! NOTE Writing 5 resets the peak RSS (VmHWM) to the current RSS, see proc(5)
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+#endif
+}
@@ -21,6 +21,12 @@
  */
 #pragma once
 
+#include <functional>
+
+#include <QStringList>
+
+#include "io/path.h"
+
 #include "notation/inotation.h"
 #include "notation/notationtypes.h"
 
@@ -38,5 +44,25 @@ public:
     static muse::Ret applyTranspose(const notation::INotationPtr notation, const std::string& optionsJson);
     static muse::Ret applyTranspose(const notation::INotationPtr notation, const notation::TransposeOptions& options);
     static void setVisibleParts(const notation::INotationPtr notation, const std::vector<size_t>& visibleParts);
+
+    //! NOTE The outputs of a job, by how they are written
+    struct JobOutputs {
+        std::vector<muse::io::path_t> partsOuts;      // a file per part, like "name-*.pdf"
+        std::vector<muse::io::path_t> audioPartsOuts; // exported together, part by part
+        std::vector<muse::io::path_t> scoreOuts;
+    };
+
+    static bool isPartsOut(const muse::io::path_t& out);
+    static JobOutputs splitJobOutputs(const std::vector<muse::io::path_t>& outs,
+                                      const std::function<bool(const std::string& suffix)>& isAudioSuffix);
+
+    //! NOTE The command line of a batch worker process: the arguments this process was started with
+    //! (the program first), without the job file and the batch options, plus the worker's own job file and report
+    static QStringList batchWorkerArguments(const QStringList& arguments, const QString& jobPath, const QString& reportPath);
+
+    //! NOTE Peak resident memory of this process, in bytes (0 if unknown).
+    //! Resetting is only supported on Linux; elsewhere the peak is the process high-water mark
+    static uint64_t peakMemoryUsage();
+    static void resetPeakMemoryUsage();
 };
 }
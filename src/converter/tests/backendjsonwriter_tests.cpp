@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <QBuffer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "converter/internal/compat/backendjsonwriter.h"
+
+using namespace mu::converter;
+
+static QByteArray makeData(qsizetype size)
+{
+    QByteArray data(size, Qt::Uninitialized);
+    for (qsizetype i = 0; i < size; ++i) {
+        data[i] = static_cast<char>((i * 7 + i / 251) & 0xFF);
+    }
+
+    return data;
+}
+
+class Converter_BackendJsonWriterTests : public ::testing::Test
+{
+};
+
+TEST_F(Converter_BackendJsonWriterTests, Base64ValueMatchesWholeEncoding)
+{
+    //! NOTE Sizes around the boundaries of the chunks the writer encodes
+    const std::vector<qsizetype> sizes = {
+        0, 1, 2, 3, 4,
+        3 * 16 * 1024 - 1, 3 * 16 * 1024, 3 * 16 * 1024 + 1, 3 * 16 * 1024 + 2,
+        3 * 3 * 16 * 1024 + 5
+    };
+
+    for (qsizetype size : sizes) {
+        // [GIVEN] Some binary data
+        const QByteArray data = makeData(size);
+
+        // [WHEN] Write it as a base64 value and as an array of base64 values
+        QByteArray json;
+        {
+            QBuffer buffer(&json);
+            BackendJsonWriter jsonWriter(&buffer);
+
+            jsonWriter.addKey("value");
+            jsonWriter.addBase64Value(data, true);
+
+            jsonWriter.addKey("array");
+            jsonWriter.openArray();
+            jsonWriter.addBase64Value(data, true);
+            jsonWriter.addBase64Value(data);
+            jsonWriter.closeArray();
+        }
+
+        // [THEN] The output is valid JSON and the values are the same as encoding the data at once
+        QJsonParseError error;
+        const QJsonObject obj = QJsonDocument::fromJson(json, &error).object();
+        ASSERT_EQ(error.error, QJsonParseError::NoError) << "size: " << size;
+
+        const QString expected = QString::fromLatin1(data.toBase64());
+        EXPECT_EQ(obj.value("value").toString(), expected) << "size: " << size;
+
+        const QJsonArray array = obj.value("array").toArray();
+        ASSERT_EQ(array.size(), 2);
+        EXPECT_EQ(array.at(0).toString(), expected) << "size: " << size;
+        EXPECT_EQ(array.at(1).toString(), expected) << "size: " << size;
+    }
+}
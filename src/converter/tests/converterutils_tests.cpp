@@ -0,0 +1,93 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "converter/internal/converterutils.h"
+
+using namespace mu::converter;
+using namespace muse;
+
+class Converter_ConverterUtilsTests : public ::testing::Test
+{
+};
+
+TEST_F(Converter_ConverterUtilsTests, SplitJobOutputs)
+{
+    // [GIVEN] A job with score outputs, parts outputs and parts audio outputs
+    const std::vector<io::path_t> outs {
+        "out/score.pdf",
+        "out/score-*.pdf",
+        "out/score.mp3",
+        "out/score-*.mp3",
+        "out/score-*.png",
+        "out/score.mscz",
+        "out/score-*.wav",
+    };
+
+    auto isAudioSuffix = [](const std::string& suffix) {
+        return suffix == "mp3" || suffix == "wav";
+    };
+
+    // [WHEN] Split the outputs
+    ConverterUtils::JobOutputs jobOuts = ConverterUtils::splitJobOutputs(outs, isAudioSuffix);
+
+    // [THEN] The parts outputs, that are written before the extension is performed, are separated
+    //        from the score outputs, and every group keeps the order of the job
+    EXPECT_EQ(jobOuts.partsOuts, std::vector<io::path_t>({ "out/score-*.pdf", "out/score-*.png" }));
+    EXPECT_EQ(jobOuts.audioPartsOuts, std::vector<io::path_t>({ "out/score-*.mp3", "out/score-*.wav" }));
+    EXPECT_EQ(jobOuts.scoreOuts, std::vector<io::path_t>({ "out/score.pdf", "out/score.mp3", "out/score.mscz" }));
+}
+
+TEST_F(Converter_ConverterUtilsTests, IsPartsOut)
+{
+    EXPECT_TRUE(ConverterUtils::isPartsOut("out/score-*.pdf"));
+    EXPECT_TRUE(ConverterUtils::isPartsOut("*.pdf"));
+    EXPECT_FALSE(ConverterUtils::isPartsOut("out/score.pdf"));
+    EXPECT_FALSE(ConverterUtils::isPartsOut("out*/score.pdf"));
+}
+
+TEST_F(Converter_ConverterUtilsTests, BatchWorkerArguments)
+{
+    // [GIVEN] A batch conversion started with non-default options
+    const QStringList arguments {
+        "/bin/mscore", "-S", "style.mss", "-j", "job.json", "-r", "150", "-T", "10", "--batch-workers", "4",
+        "--gp-linked", "--migration", "full", "--batch-report=report.json", "-b", "128", "-M", "midi.xml",
+        "--musicxml-use-default-font", "--", "-score.mscz"
+    };
+
+    // [WHEN] Build the command line of a worker
+    const QStringList workerArguments = ConverterUtils::batchWorkerArguments(arguments, "worker-job.json", "worker-report.json");
+
+    // [THEN] The worker gets every option but the job file and the batch options, which are replaced by its own,
+    //        and the positional arguments stay last
+    EXPECT_EQ(workerArguments, QStringList({
+        "-S", "style.mss", "-r", "150", "-T", "10", "--gp-linked", "--migration", "full", "-b", "128", "-M", "midi.xml",
+        "--musicxml-use-default-font", "-j", "worker-job.json", "--batch-report", "worker-report.json", "--", "-score.mscz"
+    }));
+
+    // [THEN] The other spellings of the job option are removed too
+    EXPECT_EQ(ConverterUtils::batchWorkerArguments({ "/bin/mscore", "--job", "job.json", "-r", "150" }, "w.json", "r.json"),
+              QStringList({ "-r", "150", "-j", "w.json", "--batch-report", "r.json" }));
+    EXPECT_EQ(ConverterUtils::batchWorkerArguments({ "/bin/mscore", "-jjob.json", "--job=job.json", "--batch-workers=2" },
+                                                   "w.json", "r.json"),
+              QStringList({ "-j", "w.json", "--batch-report", "r.json" }));
+}
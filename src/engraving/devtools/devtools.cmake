@@ -14,4 +14,6 @@ set(DEVTOOLS_SRC
     ${CMAKE_CURRENT_LIST_DIR}/drawdata/drawdataconverter.h
     ${CMAKE_CURRENT_LIST_DIR}/drawdata/drawdatacomparator.cpp
     ${CMAKE_CURRENT_LIST_DIR}/drawdata/drawdatacomparator.h
+    ${CMAKE_CURRENT_LIST_DIR}/drawdata/drawdatahash.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/drawdata/drawdatahash.h
 )
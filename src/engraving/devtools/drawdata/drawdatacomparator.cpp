@@ -28,6 +28,7 @@
 #include "draw/utils/drawdatarw.h"
 
 #include "drawdataerrors.h"
+#include "drawdatahash.h"
 
 using namespace muse;
 using namespace muse::draw;
@@ -35,12 +36,51 @@ using namespace mu::engraving;
 
 Diff DrawDataComparator::compare(const DrawDataPtr& ref, const DrawDataPtr& test)
 {
-    Diff diff = DrawDataComp::compare(ref, test);
-    return diff;
+    if (ref == test) {
+        return Diff();
+    }
+
+    const DrawDataHash::Index refIndex = DrawDataHash::index(ref);
+    const DrawDataHash::Index testIndex = DrawDataHash::index(test);
+
+    //! NOTE If the data of the root or the number of pages differ, the pages can't be matched
+    if (refIndex.rootHash == DrawDataHash::NO_HASH || refIndex.rootHash != testIndex.rootHash
+        || refIndex.pageHashes.size() != testIndex.pageHashes.size()) {
+        return DrawDataComp::compare(ref, test);
+    }
+
+    std::vector<size_t> changedPages;
+    for (size_t i = 0; i < refIndex.pageHashes.size(); ++i) {
+        const DrawDataHash::Hash refHash = refIndex.pageHashes.at(i);
+        if (refHash == DrawDataHash::NO_HASH || refHash != testIndex.pageHashes.at(i)) {
+            changedPages.push_back(i);
+        }
+    }
+
+    if (changedPages.empty()) {
+        return Diff();
+    }
+
+    if (changedPages.size() == refIndex.pageHashes.size()) {
+        return DrawDataComp::compare(ref, test);
+    }
+
+    return DrawDataComp::compare(pagesOnly(ref, changedPages), pagesOnly(test, changedPages));
 }
 
 Ret DrawDataComparator::compare(const muse::io::path_t& ref, const muse::io::path_t& test, const muse::io::path_t& outdiff)
 {
+    //! NOTE Most of the compared scores are unchanged. If both files have an index with the same hashes,
+    //! they are accepted without parsing them. The index is written only for the generated data,
+    //! and describes the size of the data file, so a broken or a replaced data file is parsed
+    RetVal<DrawDataHash::Index> refIndex = DrawDataHash::readIndex(ref);
+    if (refIndex.ret && refIndex.val.isComplete()) {
+        RetVal<DrawDataHash::Index> testIndex = DrawDataHash::readIndex(test);
+        if (testIndex.ret && testIndex.val == refIndex.val) {
+            return muse::make_ok();
+        }
+    }
+
     RetVal<DrawDataPtr> refData = DrawDataRW::readData(ref);
     if (!refData.ret) {
         return refData.ret;
@@ -51,7 +91,7 @@ Ret DrawDataComparator::compare(const muse::io::path_t& ref, const muse::io::pat
         return testData.ret;
     }
 
-    Diff diff = DrawDataComp::compare(refData.val, testData.val);
+    Diff diff = compare(refData.val, testData.val);
 
     if (diff.empty()) {
         return muse::make_ok();
@@ -62,3 +102,19 @@ Ret DrawDataComparator::compare(const muse::io::path_t& ref, const muse::io::pat
     DrawDataRW::writeDiff(outdiff, diff);
     return make_ret(Err::DDiff);
 }
+
+//! NOTE The root data and the given pages, the states are shared by all of them
+DrawDataPtr DrawDataComparator::pagesOnly(const DrawDataPtr& data, const std::vector<size_t>& pageIndexes) const
+{
+    DrawDataPtr pages = std::make_shared<DrawData>();
+    pages->viewport = data->viewport;
+    pages->states = data->states;
+    pages->item.name = data->item.name;
+    pages->item.datas = data->item.datas;
+
+    for (size_t i : pageIndexes) {
+        pages->item.chilren.push_back(data->item.chilren.at(i));
+    }
+
+    return pages;
+}
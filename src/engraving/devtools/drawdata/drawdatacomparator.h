@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_DRAWDATACOMPARATOR_H
 #define MU_ENGRAVING_DRAWDATACOMPARATOR_H
 
+#include <vector>
+
 #include "global/types/ret.h"
 #include "global/io/path.h"
 #include "draw/types/drawdata.h"
@@ -34,6 +36,9 @@ public:
 
     muse::draw::Diff compare(const muse::draw::DrawDataPtr& ref, const muse::draw::DrawDataPtr& test);
     muse::Ret compare(const muse::io::path_t& ref, const muse::io::path_t& test, const muse::io::path_t& outdiff);
+
+private:
+    muse::draw::DrawDataPtr pagesOnly(const muse::draw::DrawDataPtr& data, const std::vector<size_t>& pageIndexes) const;
 };
 }
 
@@ -22,6 +22,7 @@
 #include "drawdatagenerator.h"
 
 #include "global/io/dir.h"
+#include "global/io/file.h"
 #include "global/io/fileinfo.h"
 
 #include "draw/bufferedpaintprovider.h"
@@ -33,6 +34,8 @@
 #include "engraving/rw/mscloader.h"
 #include "engraving/dom/masterscore.h"
 
+#include "drawdatahash.h"
+
 // #ifdef MUE_BUILD_IMPEXP_GUITARPRO_MODULE
 // #include "importexport/guitarpro/internal/guitarproreader.h"
 // #endif
@@ -94,10 +97,18 @@ Ret DrawDataGenerator::processDir(const muse::io::path_t& scoreDir, const muse::
 
 Ret DrawDataGenerator::processFile(const muse::io::path_t& scoreFile, const muse::io::path_t& outFile, const GenOpt& opt)
 {
+    //! NOTE An index left from a previous run would describe other data
+    io::File::remove(DrawDataHash::indexPath(outFile));
+
     DrawDataPtr drawData = genDrawData(scoreFile, opt);
+    if (!drawData) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
     DrawDataRW::writeData(outFile, drawData);
 
-    return muse::make_ok();
+    //! NOTE Lets the comparator skip the data with the same hashes, without parsing it
+    return DrawDataHash::writeIndex(outFile, drawData);
 }
 
 DrawDataPtr DrawDataGenerator::genDrawData(const muse::io::path_t& scorePath, const GenOpt& opt) const
@@ -0,0 +1,358 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "drawdatahash.h"
+
+#include <cmath>
+#include <cstring>
+
+#include <QFileInfo>
+
+#include "global/io/file.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::draw;
+using namespace mu::engraving;
+
+static const char INDEX_MAGIC[4] = { 'M', 'D', 'D', 'H' };
+static constexpr uint32_t INDEX_VERSION = 2;
+static constexpr size_t INDEX_HEADER_SIZE = 4 + 4 + 8 + 8 + 8 + 4;
+
+//! NOTE The coordinates are hashed with the precision of the comparison
+static constexpr double COORD_PRECISION = 1000.0;
+
+namespace {
+//! NOTE FNV-1a
+struct Hasher {
+    uint64_t hash = 14695981039346656037ull;
+
+    void add(const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    }
+
+    void add(int64_t v) { add(&v, sizeof(v)); }
+    void add(bool v) { add(static_cast<int64_t>(v)); }
+    void add(double v) { add(static_cast<int64_t>(std::llround(v * COORD_PRECISION))); }
+
+    void add(const std::string& s)
+    {
+        add(static_cast<int64_t>(s.size()));
+        add(s.data(), s.size());
+    }
+
+    void add(const Color& c)
+    {
+        add(static_cast<int64_t>(c.red()));
+        add(static_cast<int64_t>(c.green()));
+        add(static_cast<int64_t>(c.blue()));
+        add(static_cast<int64_t>(c.alpha()));
+    }
+
+    void add(const RectF& r)
+    {
+        add(r.x());
+        add(r.y());
+        add(r.width());
+        add(r.height());
+    }
+
+    DrawDataHash::Hash result() const
+    {
+        return hash != DrawDataHash::NO_HASH ? hash : 1;
+    }
+};
+
+void addState(Hasher& h, const DrawData::State& st)
+{
+    h.add(st.pen.color());
+    h.add(st.pen.widthF());
+    h.add(static_cast<int64_t>(st.pen.style()));
+    h.add(static_cast<int64_t>(st.pen.capStyle()));
+    h.add(static_cast<int64_t>(st.pen.joinStyle()));
+
+    h.add(st.brush.color());
+    h.add(static_cast<int64_t>(st.brush.style()));
+
+    h.add(st.font.family().id().toStdString());
+    h.add(st.font.pointSizeF());
+    h.add(static_cast<int64_t>(st.font.weight()));
+    h.add(st.font.italic());
+
+    h.add(st.transform.m11());
+    h.add(st.transform.m12());
+    h.add(st.transform.m21());
+    h.add(st.transform.m22());
+    h.add(st.transform.dx());
+    h.add(st.transform.dy());
+
+    h.add(st.isAntialiasing);
+    h.add(static_cast<int64_t>(st.compositionMode));
+}
+
+//! NOTE Returns false if the data has content that isn't hashed
+bool addData(Hasher& h, const DrawDataPtr& data, const DrawData::Data& d)
+{
+    if (!d.pixmaps.empty()) {
+        return false;
+    }
+
+    //! NOTE The state is hashed by its value, the indexes of the states differ between the files
+    if (d.state >= 0) {
+        addState(h, data->states.at(d.state));
+    }
+
+    h.add(static_cast<int64_t>(d.paths.size()));
+    for (const PainterPath& path : d.paths) {
+        h.add(static_cast<int64_t>(path.fillRule()));
+        h.add(static_cast<int64_t>(path.elementCount()));
+        for (size_t i = 0; i < static_cast<size_t>(path.elementCount()); ++i) {
+            const PainterPath::Element& e = path.elementAt(i);
+            h.add(static_cast<int64_t>(e.type));
+            h.add(e.x);
+            h.add(e.y);
+        }
+    }
+
+    h.add(static_cast<int64_t>(d.polygons.size()));
+    for (const DrawPolygon& polygon : d.polygons) {
+        h.add(static_cast<int64_t>(polygon.mode));
+        h.add(static_cast<int64_t>(polygon.polygon.size()));
+        for (const PointF& p : polygon.polygon) {
+            h.add(p.x());
+            h.add(p.y());
+        }
+    }
+
+    h.add(static_cast<int64_t>(d.texts.size()));
+    for (const DrawText& text : d.texts) {
+        h.add(static_cast<int64_t>(text.mode));
+        h.add(text.rect);
+        h.add(static_cast<int64_t>(text.flags));
+        h.add(text.text.toStdString());
+    }
+
+    return true;
+}
+
+bool addItem(Hasher& h, const DrawDataPtr& data, const DrawData::Item& item)
+{
+    h.add(item.name);
+
+    h.add(static_cast<int64_t>(item.datas.size()));
+    for (const DrawData::Data& d : item.datas) {
+        if (!addData(h, data, d)) {
+            return false;
+        }
+    }
+
+    h.add(static_cast<int64_t>(item.chilren.size()));
+    for (const DrawData::Item& child : item.chilren) {
+        if (!addItem(h, data, child)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void writeUInt(ByteArray& out, uint64_t v, size_t size)
+{
+    for (size_t i = 0; i < size; ++i) {
+        out.push_back(static_cast<uint8_t>((v >> (8 * i)) & 0xFF));
+    }
+}
+
+uint64_t readUInt(const uint8_t* in, size_t size)
+{
+    uint64_t v = 0;
+    for (size_t i = 0; i < size; ++i) {
+        v |= static_cast<uint64_t>(in[i]) << (8 * i);
+    }
+    return v;
+}
+}
+
+bool DrawDataHash::Index::isComplete() const
+{
+    if (rootHash == NO_HASH) {
+        return false;
+    }
+
+    for (Hash h : pageHashes) {
+        if (h == NO_HASH) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DrawDataHash::Index::operator==(const Index& other) const
+{
+    return rootHash == other.rootHash && pageHashes == other.pageHashes;
+}
+
+DrawDataHash::Hash DrawDataHash::itemHash(const DrawDataPtr& data, const DrawData::Item& item)
+{
+    Hasher h;
+    if (!addItem(h, data, item)) {
+        return NO_HASH;
+    }
+
+    return h.result();
+}
+
+DrawDataHash::Hash DrawDataHash::rootHash(const DrawDataPtr& data)
+{
+    Hasher h;
+    h.add(data->viewport);
+    h.add(data->item.name);
+
+    for (const DrawData::Data& d : data->item.datas) {
+        if (!addData(h, data, d)) {
+            return NO_HASH;
+        }
+    }
+
+    return h.result();
+}
+
+DrawDataHash::Index DrawDataHash::index(const DrawDataPtr& data)
+{
+    Index idx;
+    idx.rootHash = rootHash(data);
+
+    idx.pageHashes.reserve(data->item.chilren.size());
+    for (const DrawData::Item& page : data->item.chilren) {
+        idx.pageHashes.push_back(itemHash(data, page));
+    }
+
+    return idx;
+}
+
+muse::io::path_t DrawDataHash::indexPath(const muse::io::path_t& dataFile)
+{
+    return dataFile + ".hash";
+}
+
+//! NOTE Hashing the file is much cheaper than parsing it, and unlike the size and the modification time
+//! it also tells apart a data file rewritten with the same size (e.g. by another run, or restored from git)
+RetVal<DrawDataHash::Hash> DrawDataHash::dataFileHash(const muse::io::path_t& dataFile)
+{
+    ByteArray data;
+    Ret ret = io::File::readFile(dataFile, data);
+    if (!ret) {
+        return ret;
+    }
+
+    Hasher h;
+    h.add(data.constData(), data.size());
+
+    return RetVal<Hash>::make_ok(h.result());
+}
+
+Ret DrawDataHash::writeIndex(const muse::io::path_t& dataFile, const DrawDataPtr& data)
+{
+    IF_ASSERT_FAILED(data) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    const Index idx = index(data);
+
+    RetVal<Hash> fileHash = dataFileHash(dataFile);
+    if (!fileHash.ret) {
+        return fileHash.ret;
+    }
+
+    ByteArray out;
+    out.reserve(INDEX_HEADER_SIZE + idx.pageHashes.size() * 8);
+    for (char c : INDEX_MAGIC) {
+        out.push_back(static_cast<uint8_t>(c));
+    }
+    writeUInt(out, INDEX_VERSION, 4);
+    writeUInt(out, static_cast<uint64_t>(QFileInfo(dataFile.toQString()).size()), 8);
+    writeUInt(out, fileHash.val, 8);
+    writeUInt(out, idx.rootHash, 8);
+    writeUInt(out, idx.pageHashes.size(), 4);
+    for (Hash h : idx.pageHashes) {
+        writeUInt(out, h, 8);
+    }
+
+    return io::File::writeFile(indexPath(dataFile), out);
+}
+
+RetVal<DrawDataHash::Index> DrawDataHash::readIndex(const muse::io::path_t& dataFile)
+{
+    ByteArray in;
+    Ret ret = io::File::readFile(indexPath(dataFile), in);
+    if (!ret) {
+        return ret;
+    }
+
+    if (in.size() < INDEX_HEADER_SIZE || std::memcmp(in.constData(), INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    const uint8_t* p = in.constData() + sizeof(INDEX_MAGIC);
+    if (readUInt(p, 4) != INDEX_VERSION) {
+        return make_ret(Ret::Code::NotSupported);
+    }
+    p += 4;
+
+    Index idx;
+    idx.dataFileSize = readUInt(p, 8);
+    p += 8;
+    idx.dataFileHash = readUInt(p, 8);
+    p += 8;
+    idx.rootHash = readUInt(p, 8);
+    p += 8;
+    const size_t pageCount = static_cast<size_t>(readUInt(p, 4));
+    p += 4;
+
+    if (in.size() != INDEX_HEADER_SIZE + pageCount * 8) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    idx.pageHashes.resize(pageCount);
+    for (size_t i = 0; i < pageCount; ++i) {
+        idx.pageHashes[i] = readUInt(p + i * 8, 8);
+    }
+
+    //! NOTE The index describes the data file it was written with.
+    //! The size is checked first, so that the file isn't read when it obviously differs
+    if (idx.dataFileSize != static_cast<uint64_t>(QFileInfo(dataFile.toQString()).size())) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    RetVal<Hash> fileHash = dataFileHash(dataFile);
+    if (!fileHash.ret || fileHash.val != idx.dataFileHash) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    return RetVal<Index>::make_ok(idx);
+}
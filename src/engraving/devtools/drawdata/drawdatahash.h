@@ -0,0 +1,75 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "global/types/ret.h"
+#include "global/types/retval.h"
+#include "global/io/path.h"
+#include "draw/types/drawdata.h"
+
+namespace mu::engraving {
+//! NOTE Hashes of the drawn content of the objects (an object together with its children).
+//! The pages are the top level objects, so the comparator can skip the pages with the same hash
+//! and diff only the others.
+//!
+//! The generator writes the hashes of a data file to a small binary index next to it
+//! (see indexPath), so that the comparator doesn't parse the data files with the same hashes.
+//! Index layout, little endian:
+//!     char[4]  magic "MDDH"
+//!     uint32   version
+//!     uint64   size of the data file, in bytes
+//!     uint64   hash of the content of the data file
+//!     uint64   hash of the data of the root object (without the pages)
+//!     uint32   page count
+//!     uint64   hash of each page
+class DrawDataHash
+{
+public:
+    using Hash = uint64_t;
+
+    //! NOTE Content that isn't hashed (pixmaps), always compared
+    static constexpr Hash NO_HASH = 0;
+
+    struct Index {
+        uint64_t dataFileSize = 0;
+        Hash dataFileHash = NO_HASH;
+        Hash rootHash = NO_HASH;
+        std::vector<Hash> pageHashes;
+
+        bool isComplete() const;
+        bool operator==(const Index& other) const;
+    };
+
+    static Hash itemHash(const muse::draw::DrawDataPtr& data, const muse::draw::DrawData::Item& item);
+    static Hash rootHash(const muse::draw::DrawDataPtr& data);
+    static Index index(const muse::draw::DrawDataPtr& data);
+
+    static muse::io::path_t indexPath(const muse::io::path_t& dataFile);
+    static muse::RetVal<Hash> dataFileHash(const muse::io::path_t& dataFile);
+    static muse::Ret writeIndex(const muse::io::path_t& dataFile, const muse::draw::DrawDataPtr& data);
+    static muse::RetVal<Index> readIndex(const muse::io::path_t& dataFile);
+};
+}
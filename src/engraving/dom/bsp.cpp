@@ -62,7 +62,10 @@ class FindItemBspTreeVisitor : public BspTreeVisitor
 {
     OBJECT_ALLOCATOR(engraving, FindItemBspTreeVisitor)
 public:
-    std::vector<EngravingItem*> foundItems;
+    explicit FindItemBspTreeVisitor(std::vector<EngravingItem*>& foundItems)
+        : foundItems(foundItems) {}
+
+    std::vector<EngravingItem*>& foundItems;
 
     void visit(std::vector<EngravingItem*>& items) override
     {
@@ -148,35 +151,46 @@ void BspTree::remove(EngravingItem* element)
 
 std::vector<EngravingItem*> BspTree::items(const RectF& rec)
 {
-    FindItemBspTreeVisitor findVisitor;
-    climbTree(&findVisitor, rec);
     std::vector<EngravingItem*> l;
-    for (EngravingItem* e : findVisitor.foundItems) {
-        e->itemDiscovered = false;
-        if (e->pageBoundingRect().intersects(rec)) {
-            l.push_back(e);
-        }
-    }
+    items(rec, l);
     return l;
 }
 
+void BspTree::items(const RectF& rec, std::vector<EngravingItem*>& result)
+{
+    result.clear();
+
+    FindItemBspTreeVisitor findVisitor(result);
+    climbTree(&findVisitor, rec);
+
+    muse::remove_if(result, [&rec](EngravingItem* e) {
+        e->itemDiscovered = false;
+        return !e->pageBoundingRect().intersects(rec);
+    });
+}
+
 //---------------------------------------------------------
 //   items
 //---------------------------------------------------------
 
 std::vector<EngravingItem*> BspTree::items(const PointF& pos)
 {
-    FindItemBspTreeVisitor findVisitor;
+    std::vector<EngravingItem*> l;
+    items(pos, l);
+    return l;
+}
+
+void BspTree::items(const PointF& pos, std::vector<EngravingItem*>& result)
+{
+    result.clear();
+
+    FindItemBspTreeVisitor findVisitor(result);
     climbTree(&findVisitor, pos);
 
-    std::vector<EngravingItem*> l;
-    for (EngravingItem* e : findVisitor.foundItems) {
+    muse::remove_if(result, [&pos](EngravingItem* e) {
         e->itemDiscovered = false;
-        if (e->contains(pos)) {
-            l.push_back(e);
-        }
-    }
-    return l;
+        return !e->contains(pos);
+    });
 }
 
 //---------------------------------------------------------
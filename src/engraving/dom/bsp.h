@@ -82,6 +82,11 @@ public:
     std::vector<EngravingItem*> items(const RectF& rect);
     std::vector<EngravingItem*> items(const PointF& pos);
 
+    // Same as above, but fills a caller-owned buffer so that repeated
+    // queries (e.g. hit-testing on mouse move) don't allocate
+    void items(const RectF& rect, std::vector<EngravingItem*>& result);
+    void items(const PointF& pos, std::vector<EngravingItem*>& result);
+
     EngravingItem* nearestNeighbor(const PointF& pos);
 
     int leafCount() const { return m_leafCnt; }
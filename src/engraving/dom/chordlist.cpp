@@ -1982,6 +1982,7 @@ int ChordList::privateID = -1000;
 void ChordList::configureAutoAdjust(double emag, double eadjust, double mmag, double madjust, double stackedmmag, bool stackModifiers,
                                     bool excludeModsHAlign, String symbolFont, const ChordStylePreset& preset)
 {
+    invalidateCaches();
     m_stackModifiers = stackModifiers;
     m_excludeModsHAlign = excludeModsHAlign;
     m_emag = emag;
@@ -1999,6 +2000,8 @@ void ChordList::configureAutoAdjust(double emag, double eadjust, double mmag, do
 
 void ChordList::read(XmlReader& e, int mscVersion)
 {
+    invalidateCaches();
+
     int fontIdx = static_cast<int>(fonts.size());
     m_autoAdjust = false;
     while (e.readNextStartElement()) {
@@ -2267,6 +2270,7 @@ bool ChordList::loaded() const
 
 void ChordList::unload()
 {
+    invalidateCaches();
     clear();
     m_symbols.clear();
     fonts.clear();
@@ -2285,6 +2289,87 @@ const ChordDescription* ChordList::description(int id) const
     return &it->second;
 }
 
+//---------------------------------------------------------
+//   description
+//    look up by name, optionally by parsed chord as fallback
+//    an exact name match wins over a parsed match
+//---------------------------------------------------------
+
+const ChordDescription* ChordList::description(const String& name, const ParsedChord* pc) const
+{
+    ensureDescriptionIndex();
+
+    auto it = m_caches.byName.find(name);
+    if (it != m_caches.byName.end()) {
+        return it->second;
+    }
+
+    if (!pc) {
+        return nullptr;
+    }
+
+    auto pit = m_caches.byParsedChord.find(pc->handle());
+    return pit != m_caches.byParsedChord.end() ? pit->second : nullptr;
+}
+
+//! NOTE Same precedence as a linear scan by id: the first description with a given name,
+//! the last one with a given parsed chord. Only descriptions with names take part.
+//! New descriptions are only ever added to the list, so a size change means the index is stale.
+void ChordList::ensureDescriptionIndex() const
+{
+    if (m_caches.indexedSize == this->size()) {
+        return;
+    }
+
+    m_caches.byName.clear();
+    m_caches.byParsedChord.clear();
+
+    for (const auto& p : *this) {
+        const ChordDescription& cd = p.second;
+        if (cd.names.empty()) {
+            continue;
+        }
+        for (const String& name : cd.names) {
+            m_caches.byName.emplace(name, &cd);
+        }
+        for (const ParsedChord& parsed : cd.parsedChords) {
+            m_caches.byParsedChord[parsed.handle()] = &cd;
+        }
+    }
+
+    m_caches.indexedSize = this->size();
+}
+
+//---------------------------------------------------------
+//   parsedChord
+//    parse results are shared by all chord symbols using this list
+//---------------------------------------------------------
+
+const ParsedChord& ChordList::parsedChord(const String& text, bool syntaxOnly, bool preferMinor) const
+{
+    static constexpr size_t MAX_CACHED_PARSED_CHORDS = 4096;
+
+    const String key = text + (syntaxOnly ? u"\u0001" : u"\u0002") + (preferMinor ? u"\u0001" : u"\u0002");
+
+    auto it = m_caches.parsedChords.find(key);
+    if (it != m_caches.parsedChords.end()) {
+        return it->second;
+    }
+
+    if (m_caches.parsedChords.size() >= MAX_CACHED_PARSED_CHORDS) {
+        m_caches.parsedChords.clear();
+    }
+
+    ParsedChord& pc = m_caches.parsedChords[key];
+    pc.parse(text, this, syntaxOnly, preferMinor);
+    return pc;
+}
+
+void ChordList::invalidateCaches() const
+{
+    m_caches.clear();
+}
+
 ChordToken ChordList::token(const String& s, ChordTokenClass type) const
 {
     for (const ChordToken& tok : chordTokenList) {
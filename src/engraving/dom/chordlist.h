@@ -24,6 +24,7 @@
 #define MU_ENGRAVING_CHORDLIST_H
 
 #include <map>
+#include <unordered_map>
 
 #include "global/allocator.h"
 #include "global/types/string.h"
@@ -493,6 +494,10 @@ public:
     void unload();
 
     const ChordDescription* description(int id) const;
+    const ChordDescription* description(const String& name, const ParsedChord* pc = nullptr) const;
+    const ParsedChord& parsedChord(const String& text, bool syntaxOnly = false, bool preferMinor = false) const;
+    void invalidateCaches() const;
+
     ChordSymbol symbol(const String& s) const { return muse::value(m_symbols, s); }
     ChordToken token(const String& s, ChordTokenClass) const;
 
@@ -517,6 +522,32 @@ private:
     String m_symbolTextFont = u"";
 
     bool m_customChordList = false;         // if true, chordlist will be saved as part of score
+
+    //! NOTE Lookup indexes of the descriptions, built on demand.
+    //! They point into this list, so they are never copied along with it.
+    struct Caches {
+        std::unordered_map<String, const ChordDescription*> byName;
+        std::unordered_map<String /*handle*/, const ChordDescription*> byParsedChord;
+        size_t indexedSize = muse::nidx;
+
+        std::unordered_map<String, ParsedChord> parsedChords;
+
+        Caches() = default;
+        Caches(const Caches&) {}
+        Caches& operator=(const Caches&) { clear(); return *this; }
+
+        void clear()
+        {
+            byName.clear();
+            byParsedChord.clear();
+            indexedSize = muse::nidx;
+            parsedChords.clear();
+        }
+    };
+
+    void ensureDescriptionIndex() const;
+
+    mutable Caches m_caches;
 };
 } // namespace mu::engraving
 #endif
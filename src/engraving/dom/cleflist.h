@@ -23,6 +23,7 @@
 #ifndef MU_ENGRAVING_CLEFLIST_H
 #define MU_ENGRAVING_CLEFLIST_H
 
+#include "../infrastructure/flatmap.h"
 #include "clef.h"
 
 namespace mu::engraving {
@@ -30,7 +31,7 @@ namespace mu::engraving {
 //   ClefList
 //---------------------------------------------------------
 
-class ClefList : public std::map<int, ClefTypeList>
+class ClefList : public FlatMap<int, ClefTypeList>
 {
     OBJECT_ALLOCATOR(engraving, ClefList)
 public:
@@ -25,6 +25,7 @@
 
 #include "../types/fraction.h"
 #include "../types/types.h"
+#include "types/bytearray.h"
 #include "types/string.h"
 
 #include "async/notification.h"
@@ -83,6 +84,17 @@ public:
     const TracksMap& tracksMapping();
     void setTracksMapping(const TracksMap& tracksMapping);
 
+    //! NOTE The part files as they were last written, with the revisions of the changes they include
+    struct WriteCache {
+        size_t scoreRevision = muse::nidx;
+        size_t unattributedRevision = muse::nidx;
+        muse::ByteArray styleData;
+        muse::ByteArray scoreData;
+    };
+
+    const WriteCache& writeCache() const { return m_writeCache; }
+    void setWriteCache(const WriteCache& cache) { m_writeCache = cache; }
+
     void setVoiceVisible(Staff* staff, voice_idx_t voiceIndex, bool visible);
 
     static std::vector<Excerpt*> createExcerptsFromParts(const std::vector<Part*>& parts, MasterScore* score);
@@ -115,6 +127,8 @@ private:
     TracksMap m_tracksMapping;
     bool m_inited = false;
     ID m_initialPartId;
+
+    WriteCache m_writeCache;
 };
 }
 
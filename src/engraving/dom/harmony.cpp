@@ -76,28 +76,10 @@ const ChordDescription* HarmonyInfo::descr() const
 
 const ChordDescription* HarmonyInfo::descr(const String& name, const ParsedChord* pc) const
 {
-    const ChordDescription* match = nullptr;
     if (!chordList()) {
         return nullptr;
     }
-    for (const auto& p : *chordList()) {
-        const ChordDescription& cd = p.second;
-        for (const String& s : cd.names) {
-            if (s == name) {
-                return &cd;
-            }
-            if (!pc) {
-                continue;
-            }
-            for (const ParsedChord& sParsed : cd.parsedChords) {
-                if (sParsed == *pc) {
-                    match = &cd;
-                }
-            }
-        }
-    }
-    // exact match failed, so fall back on parsed match if one was found
-    return match;
+    return chordList()->description(name, pc);
 }
 
 //---------------------------------------------------------
@@ -158,8 +140,12 @@ const ChordDescription* HarmonyInfo::generateDescription()
 ParsedChord* HarmonyInfo::getParsedChord()
 {
     if (!m_parsedChord) {
-        m_parsedChord = new ParsedChord();
-        m_parsedChord->parse(m_textName, chordList(), false);
+        if (const ChordList* cl = chordList()) {
+            m_parsedChord = new ParsedChord(cl->parsedChord(m_textName));
+        } else {
+            m_parsedChord = new ParsedChord();
+            m_parsedChord->parse(m_textName, nullptr, false);
+        }
     }
     return m_parsedChord;
 }
@@ -585,8 +571,7 @@ const ChordDescription* Harmony::parseSingleHarmony(const String& ss, HarmonyInf
     if (useLiteral) {
         cd = info->descr(s);
     } else {
-        ParsedChord* pc = new ParsedChord();
-        pc->parse(s, cl, syntaxOnly, preferMinor);
+        ParsedChord* pc = new ParsedChord(cl->parsedChord(s, syntaxOnly, preferMinor));
         // parser prepends "=" to name of implied minor chords
         // use this here as well
         if (preferMinor) {
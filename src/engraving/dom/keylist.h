@@ -23,9 +23,8 @@
 #ifndef MU_ENGRAVING_KEYLIST_H
 #define MU_ENGRAVING_KEYLIST_H
 
-#include <map>
-
 #include "global/allocator.h"
+#include "../infrastructure/flatmap.h"
 #include "key.h"
 
 namespace mu::engraving {
@@ -35,7 +34,7 @@ namespace mu::engraving {
 //    to keep track of key signature changes
 //---------------------------------------------------------
 
-class KeyList : public std::map<const int, KeySigEvent>
+class KeyList : public FlatMap<int, KeySigEvent>
 {
     OBJECT_ALLOCATOR(engraving, KeyList)
 public:
@@ -484,6 +484,15 @@ void MasterScore::rebuildAndUpdateExpressive(Synthesizer* synth)
     rebuildMidiMapping();
 }
 
+void MasterScore::invalidateWriteCaches()
+{
+    m_thumbnailCache = ThumbnailCache();
+
+    for (Excerpt* excerpt : m_excerpts) {
+        excerpt->setWriteCache(Excerpt::WriteCache());
+    }
+}
+
 //---------------------------------------------------------
 //   insertMeasure
 //    Create a new MeasureBase of Measure type and insert
@@ -24,8 +24,12 @@
 
 #include <array>
 
+#include "draw/types/color.h"
+#include "types/bytearray.h"
+
 #include "../infrastructure/ifileinfoprovider.h"
 #include "../infrastructure/eidregister.h"
+#include "../editing/cmdlatency.h"
 
 #include "instrument.h"
 #include "score.h"
@@ -197,6 +201,20 @@ public:
     void setWidthOfSegmentCell(double val) { m_widthOfSegmentCell = val; }
     double widthOfSegmentCell() const { return m_widthOfSegmentCell; }
 
+    //! NOTE The thumbnail as it was last written, with the revisions of the changes it includes
+    struct ThumbnailCache {
+        size_t scoreRevision = muse::nidx;
+        size_t unattributedRevision = muse::nidx;
+        Color backgroundColor;
+        muse::ByteArray pngData;
+    };
+
+    const ThumbnailCache& thumbnailCache() const { return m_thumbnailCache; }
+    void setThumbnailCache(const ThumbnailCache& cache) { m_thumbnailCache = cache; }
+
+    //! NOTE For the changes that are not counted by the change revisions
+    void invalidateWriteCaches();
+
 private:
     void update(bool resetCmdState, bool layoutAllParts = false);
 
@@ -236,6 +254,7 @@ private:
     bool m_readOnly = false;
 
     CmdState m_cmdState;       // modified during cmd processing
+    CmdLatencyRecorder m_cmdLatency;
     bool m_updatesLocked = false;
 
     std::array<Fraction, 2> m_loopBoundaries; ///< 0 - LoopIn, 1 - LoopOut
@@ -248,6 +267,8 @@ private:
     // don't decrease and don't have gaps
     double m_widthOfSegmentCell = 3;
 
+    ThumbnailCache m_thumbnailCache;
+
     std::weak_ptr<EngravingProject> m_project;
 
     // FIXME: Move to EngravingProject
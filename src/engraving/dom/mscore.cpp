@@ -57,7 +57,6 @@ double MScore::nudgeStep10;
 double MScore::nudgeStep50;
 
 bool MScore::noImages = false;
-bool MScore::pdfPrinting = false;
 bool MScore::svgPrinting = false;
 
 extern void initDrumset();
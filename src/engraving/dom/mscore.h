@@ -224,7 +224,6 @@ public:
 
     static bool noImages;
 
-    static bool pdfPrinting;
     static bool svgPrinting;
 
     static double verticalPageGap;
@@ -64,6 +64,22 @@ std::vector<EngravingItem*> Page::items(const PointF& point)
     return bspTree.items(point);
 }
 
+void Page::items(const RectF& rect, std::vector<EngravingItem*>& result)
+{
+    if (!m_bspTreeValid) {
+        doRebuildBspTree();
+    }
+    bspTree.items(rect, result);
+}
+
+void Page::items(const PointF& point, std::vector<EngravingItem*>& result)
+{
+    if (!m_bspTreeValid) {
+        doRebuildBspTree();
+    }
+    bspTree.items(point, result);
+}
+
 //---------------------------------------------------------
 //   appendSystem
 //---------------------------------------------------------
@@ -73,6 +73,8 @@ public:
 
     std::vector<EngravingItem*> items(const RectF& r);
     std::vector<EngravingItem*> items(const PointF& p);
+    void items(const RectF& r, std::vector<EngravingItem*>& result);
+    void items(const PointF& p, std::vector<EngravingItem*>& result);
     void invalidateBspTree() { m_bspTreeValid = false; }
     PointF pagePos() const override { return PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
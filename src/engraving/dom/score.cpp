@@ -750,7 +750,12 @@ void Score::dragPosition(const PointF& pos, staff_idx_t* rst, Segment** seg, dou
 
 void Score::setShowInvisible(bool v)
 {
+    if (m_showInvisible == v) {
+        return;
+    }
+
     m_showInvisible = v;
+    markChanged();
     // BSP tree does not include elements which are not
     // displayed, so we need to refresh it to get
     // invisible elements displayed or properly hidden.
@@ -763,7 +768,12 @@ void Score::setShowInvisible(bool v)
 
 void Score::setShowUnprintable(bool v)
 {
+    if (m_showUnprintable == v) {
+        return;
+    }
+
     m_showUnprintable = v;
+    markChanged();
 }
 
 //---------------------------------------------------------
@@ -772,7 +782,12 @@ void Score::setShowUnprintable(bool v)
 
 void Score::setShowFrames(bool v)
 {
+    if (m_showFrames == v) {
+        return;
+    }
+
     m_showFrames = v;
+    markChanged();
 }
 
 //---------------------------------------------------------
@@ -781,7 +796,12 @@ void Score::setShowFrames(bool v)
 
 void Score::setShowPageborders(bool v)
 {
+    if (m_showPageborders == v) {
+        return;
+    }
+
     m_showPageborders = v;
+    markChanged();
 }
 
 void Score::setShowSoundFlags(bool v)
@@ -791,6 +811,7 @@ void Score::setShowSoundFlags(bool v)
     }
 
     m_showSoundFlags = v;
+    markChanged();
     setLayoutAll();
 }
 
@@ -800,7 +821,12 @@ void Score::setShowSoundFlags(bool v)
 
 void Score::setMarkIrregularMeasures(bool v)
 {
+    if (m_markIrregularMeasures == v) {
+        return;
+    }
+
     m_markIrregularMeasures = v;
+    markChanged();
 }
 
 void Score::setShowAnchors(const ShowAnchors& showAnchors)
@@ -838,7 +864,12 @@ bool Score::isOpen() const
 
 void Score::setIsOpen(bool open)
 {
+    if (m_isOpen == open) {
+        return;
+    }
+
     m_isOpen = open;
+    markChanged();
 }
 
 //---------------------------------------------------------
@@ -1962,6 +1993,7 @@ String Score::metaTag(const String& s) const
 void Score::setMetaTag(const String& tag, const String& val)
 {
     m_metaTags.insert_or_assign(tag, val);
+    markChanged();
 }
 
 //---------------------------------------------------------
@@ -5957,6 +5989,12 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
 {
     TRACEFUNC;
 
+    if (st <= Fraction(0, 1) && et < Fraction(0, 1)) {
+        m_pendingLayoutAll = false;
+        m_pendingLayoutStart = Fraction(-1, 1);
+        m_pendingLayoutEnd = Fraction(-1, 1);
+    }
+
     Fraction start = st;
     Fraction end = et;
 
@@ -5992,6 +6030,76 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
     }
 }
 
+void Score::addPendingLayoutRange(const Fraction& st, const Fraction& et)
+{
+    if (m_pendingLayoutAll) {
+        return;
+    }
+
+    if (st < Fraction(0, 1) || et < Fraction(0, 1)) {
+        m_pendingLayoutAll = true;
+        return;
+    }
+
+    if (m_pendingLayoutStart < Fraction(0, 1)) {
+        m_pendingLayoutStart = st;
+        m_pendingLayoutEnd = et;
+        return;
+    }
+
+    m_pendingLayoutStart = std::min(m_pendingLayoutStart, st);
+    m_pendingLayoutEnd = std::max(m_pendingLayoutEnd, et);
+}
+
+bool Score::hasPendingLayout() const
+{
+    return m_pendingLayoutAll || m_pendingLayoutStart >= Fraction(0, 1);
+}
+
+void Score::doPendingLayout()
+{
+    //! NOTE Only the edits laid out by MasterScore::update() are recorded as pending.
+    //! Other changes (style changes, for one) are not, so with nothing recorded the whole score is laid out
+    if (m_pendingLayoutAll || m_pendingLayoutStart < Fraction(0, 1)) {
+        doLayout();
+        return;
+    }
+
+    const Fraction start = m_pendingLayoutStart;
+    const Fraction end = m_pendingLayoutEnd;
+    m_pendingLayoutStart = Fraction(-1, 1);
+    m_pendingLayoutEnd = Fraction(-1, 1);
+
+    doLayoutRange(start, end);
+}
+
+bool Score::doPendingLayoutStep(int maxMeasures)
+{
+    if (m_pendingLayoutAll || m_pendingLayoutStart < Fraction(0, 1)) {
+        return false;
+    }
+
+    const Fraction start = m_pendingLayoutStart;
+    Fraction end = m_pendingLayoutEnd;
+
+    const Measure* m = tick2measure(start);
+    for (int i = 0; m && i < maxMeasures; ++i) {
+        m = m->nextMeasure();
+    }
+
+    if (m && m->tick() < end) {
+        end = m->tick();
+        m_pendingLayoutStart = end;
+    } else {
+        m_pendingLayoutStart = Fraction(-1, 1);
+        m_pendingLayoutEnd = Fraction(-1, 1);
+    }
+
+    doLayoutRange(start, end);
+
+    return true;
+}
+
 void Score::createPaddingTable()
 {
     m_paddingTable.createTable(style());
@@ -881,6 +881,22 @@ public:
     void doLayout();
     void doLayoutRange(const Fraction& st, const Fraction& et);
 
+    //! NOTE Closed scores are not laid out on each edit, the edited range is accumulated
+    //! instead and laid out later: on idle, or when the score is opened or exported
+    void addPendingLayoutRange(const Fraction& st, const Fraction& et);
+    bool hasPendingLayout() const;
+    //! NOTE Lays out the pending range, or the whole score if no range is pending
+    void doPendingLayout();
+    //! NOTE Lays out at most maxMeasures of the pending range, returns false if there was nothing to do.
+    //! A full pending layout is never split and is left for doPendingLayout
+    bool doPendingLayoutStep(int maxMeasures);
+
+    //! NOTE Counts the changes made to this score by the undoable commands, to its meta tags
+    //! and to the saved flags that are set outside of the undo stack (open, show invisible etc.),
+    //! so the written score can be reused while the score doesn't change
+    size_t changesRevision() const { return m_changesRevision; }
+    void markChanged() { ++m_changesRevision; }
+
     SynthesizerState& synthesizerState() { return m_synthesizerState; }
     void setSynthesizerState(const SynthesizerState& s);
 
@@ -889,7 +905,7 @@ public:
 
     const std::map<String, String>& metaTags() const { return m_metaTags; }
     std::map<String, String>& metaTags() { return m_metaTags; }
-    void setMetaTags(const std::map<String, String>& t) { m_metaTags = t; }
+    void setMetaTags(const std::map<String, String>& t) { m_metaTags = t; markChanged(); }
 
     String metaTag(const String& tag) const;
     void setMetaTag(const String& tag, const String& val);
@@ -913,6 +929,11 @@ public:
     void setShowVBox(bool v) { m_layoutOptions.isShowVBox = v; }
     double noteHeadWidth() const { return m_layoutOptions.noteHeadWidth; }
     void setNoteHeadWidth(double n) { m_layoutOptions.noteHeadWidth = n; }
+    void setLayoutLimit(size_t pageLimit, const Fraction& endTickLimit = Fraction::max())
+    {
+        m_layoutOptions.pageLimit = pageLimit;
+        m_layoutOptions.endTickLimit = endTickLimit;
+    }
 
     // temporary methods
     bool isLayoutMode(LayoutMode lm) const { return m_layoutOptions.isMode(lm); }
@@ -1208,6 +1229,12 @@ private:
     bool m_isOpen = false;
     bool m_needSetUpTempoMap = true;
 
+    bool m_pendingLayoutAll = true; // not laid out yet
+    Fraction m_pendingLayoutStart = Fraction(-1, 1);
+    Fraction m_pendingLayoutEnd = Fraction(-1, 1);
+
+    size_t m_changesRevision = 0;
+
     std::map<String, String> m_metaTags;
 
     Selection m_selection;
@@ -167,7 +167,6 @@ bool Score::saveStyle(const String& name)
 void Score::print(Painter* painter, int pageNo)
 {
     m_printing  = true;
-    MScore::pdfPrinting = true;
 
     rendering::PaintOptions opt;
     opt.isPrinting = true;
@@ -186,7 +185,6 @@ void Score::print(Painter* painter, int pageNo)
         renderer()->drawItem(e, painter, opt);
         painter->restore();
     }
-    MScore::pdfPrinting = false;
     m_printing = false;
 }
 }
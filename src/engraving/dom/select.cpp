@@ -505,14 +505,19 @@ void Selection::appendFiltered(EngravingItem* e)
     }
 }
 
-void Selection::appendFiltered(const std::unordered_set<EngravingItem*>& elems)
+//! NOTE Appends the anchored elements collected into m_anchoredBuffer from the given position and
+//! then drops them from the buffer. Appending can recurse (grace notes), so the buffer is accessed by index.
+void Selection::appendAnchoredFiltered(size_t from)
 {
     IF_ASSERT_FAILED(!isLocked()) {
         LOGE() << "selection locked, reason: " << lockReason();
+        m_anchoredBuffer.resize(from);
         return;
     }
 
-    for (EngravingItem* elem : elems) {
+    const size_t to = m_anchoredBuffer.size();
+    for (size_t i = from; i < to; ++i) {
+        EngravingItem* elem = m_anchoredBuffer[i];
         IF_ASSERT_FAILED(!elem->isSpannerSegment()) {
             LOGE() << "Append whole spanners instead of spanner segments";
             continue;
@@ -545,6 +550,8 @@ void Selection::appendFiltered(const std::unordered_set<EngravingItem*>& elems)
 
         appendFiltered(elem);
     }
+
+    m_anchoredBuffer.resize(from);
 }
 
 void Selection::appendChordRest(ChordRest* cr)
@@ -558,8 +565,9 @@ void Selection::appendChordRest(ChordRest* cr)
         return;
     }
 
-    const std::unordered_set<EngravingItem*> crAnchored = collectElementsAnchoredToChordRest(cr);
-    appendFiltered(crAnchored);
+    const size_t crAnchoredFrom = m_anchoredBuffer.size();
+    collectElementsAnchoredToChordRest(cr, m_anchoredBuffer);
+    appendAnchoredFiltered(crAnchoredFrom);
 
     if (cr->isRestFamily()) {
         appendFiltered(cr);
@@ -583,8 +591,9 @@ void Selection::appendChordRest(ChordRest* cr)
     for (size_t noteIdx = 0; noteIdx < totalNotesInChord; ++noteIdx) {
         Note* note = chord->notes().at(noteIdx);
 
-        const std::unordered_set<EngravingItem*> noteAnchored = collectElementsAnchoredToNote(note, true, false);
-        appendFiltered(noteAnchored);
+        const size_t noteAnchoredFrom = m_anchoredBuffer.size();
+        collectElementsAnchoredToNote(note, true, false, m_anchoredBuffer);
+        appendAnchoredFiltered(noteAnchoredFrom);
 
         if (chord->isGrace() && !canSelect(chord)) {
             continue;
@@ -621,7 +630,7 @@ void Selection::appendChordRest(ChordRest* cr)
     if (totalAppendedNotes < totalNotesInChord) {
         return;
     }
-    if (chord->beam() && !muse::contains(m_el, static_cast<EngravingItem*>(chord->beam()))) {
+    if (chord->beam() && m_appendedShared.insert(chord->beam()).second) {
         m_el.push_back(chord->beam());
     }
     if (chord->stem()) {
@@ -637,7 +646,7 @@ void Selection::appendChordRest(ChordRest* cr)
 
 void Selection::appendTupletHierarchy(Tuplet* innermostTuplet)
 {
-    if (!canSelectVoice(innermostTuplet->voice()) || muse::contains(m_el, static_cast<EngravingItem*>(innermostTuplet))) {
+    if (!canSelectVoice(innermostTuplet->voice()) || muse::contains(m_appendedShared, static_cast<const EngravingItem*>(innermostTuplet))) {
         return;
     }
 
@@ -648,6 +657,7 @@ void Selection::appendTupletHierarchy(Tuplet* innermostTuplet)
     }
 
     m_el.push_back(innermostTuplet);
+    m_appendedShared.insert(innermostTuplet);
 
     // Recursively append upwards/outwards
     Tuplet* outerTuplet = innermostTuplet->tuplet();
@@ -727,6 +737,7 @@ void Selection::updateSelectedElements()
         e->setSelected(false);
     }
     m_el.clear();
+    m_appendedShared.clear();
 
     // assert:
     size_t staves = m_score->nstaves();
@@ -748,23 +759,24 @@ void Selection::updateSelectedElements()
     //! if all of their contained elements are selected...
     std::unordered_set<Tuplet*> innerTuplets;
 
-    for (track_idx_t st = startTrack; st < endTrack; ++st) {
-        for (Segment* s = m_startSegment; s && (s != m_endSegment); s = s->next1MM()) {
-            if (!s->enabled() || s->isEndBarLineType()) { // do not select end bar line
+    //! NOTE Segment-major order: each segment (and its annotations) is visited once, whatever the number of tracks
+    for (Segment* s = m_startSegment; s && (s != m_endSegment); s = s->next1MM()) {
+        if (!s->enabled() || s->isEndBarLineType()) { // do not select end bar line
+            continue;
+        }
+        for (EngravingItem* e : s->annotations()) {
+            if (e->track() < startTrack || e->track() >= endTrack) {
                 continue;
             }
-            for (EngravingItem* e : s->annotations()) {
-                if (e->track() != st) {
-                    continue;
+            if (e->isFretDiagram()) {
+                FretDiagram* fd = toFretDiagram(e);
+                if (Harmony* harm = fd->harmony()) {
+                    appendFiltered(harm);
                 }
-                if (e->isFretDiagram()) {
-                    FretDiagram* fd = toFretDiagram(e);
-                    if (Harmony* harm = fd->harmony()) {
-                        appendFiltered(harm);
-                    }
-                }
-                appendFiltered(e);
             }
+            appendFiltered(e);
+        }
+        for (track_idx_t st = startTrack; st < endTrack; ++st) {
             EngravingItem* e = s->element(st);
             if (!e || e->generated() || e->isTimeSig() || e->isKeySig()) {
                 continue;
@@ -786,8 +798,7 @@ void Selection::updateSelectedElements()
             }
 
             Chord* chord = toChord(cr);
-            const std::vector<Note*> notes = chord->notes();
-            if (notes.size() == 1) {
+            if (chord->notes().size() == 1) {
                 singleNoteChords.emplace_back(chord);
             } else {
                 appendChordRest(chord);
@@ -804,10 +815,10 @@ void Selection::updateSelectedElements()
         } else {
             // Include elements anchored to the note even if the note itself isn't included...
             const Note* note = singleNoteChord->notes().front();
-            const std::unordered_set<EngravingItem*> noteAnchored = collectElementsAnchoredToNote(note, true, false);
-            appendFiltered(noteAnchored);
-            const std::unordered_set<EngravingItem*> crAnchored = collectElementsAnchoredToChordRest(singleNoteChord);
-            appendFiltered(crAnchored);
+            const size_t anchoredFrom = m_anchoredBuffer.size();
+            collectElementsAnchoredToNote(note, true, false, m_anchoredBuffer);
+            collectElementsAnchoredToChordRest(singleNoteChord, m_anchoredBuffer);
+            appendAnchoredFiltered(anchoredFrom);
         }
     }
 
@@ -924,7 +935,7 @@ void Selection::update()
     EngravingItem* toSelectAgain = nullptr;
     if (cr->isChord()) {
         // Use the top selected note in the chord...
-        const std::vector<Note*> notes = toChord(cr)->notes();
+        const std::vector<Note*>& notes = toChord(cr)->notes();
         const size_t noteCount = notes.size();
         for (size_t noteIdx = noteCount - 1; noteIdx < noteCount; --noteIdx) {
             Note* note = notes.at(noteIdx);
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "durationtype.h"
 #include "mscore.h"
 #include "pitchspelling.h"
@@ -173,7 +175,7 @@ private:
     bool canSelectNoteIdx(size_t noteIdx, size_t totalNotesInChord, bool rangeContainsMultiNoteChords) const;
     bool canSelectVoice(track_idx_t track) const { return selectionFilter().canSelectVoice(track); }
     void appendFiltered(EngravingItem* e);
-    void appendFiltered(const std::unordered_set<EngravingItem*>& elems);
+    void appendAnchoredFiltered(size_t from);
     void appendChordRest(ChordRest* cr);
     void appendTupletHierarchy(Tuplet* innermostTuplet);
     void appendGuitarBend(GuitarBend* guitarBend);
@@ -185,6 +187,10 @@ private:
     SelState m_state = SelState::NONE;
     std::vector<EngravingItem*> m_el;            // valid in mode SelState::LIST
 
+    // Reused while a range selection is collected
+    std::vector<EngravingItem*> m_anchoredBuffer;
+    std::unordered_set<const EngravingItem*> m_appendedShared; // beams and tuplets, shared between chords
+
     staff_idx_t m_staffStart = 0;            // valid if selState is SelState::RANGE
     staff_idx_t m_staffEnd = 0;
     Segment* m_startSegment = nullptr;
@@ -22,6 +22,8 @@
 
 #include "sig.h"
 
+#include <algorithm>
+
 #include "log.h"
 
 using namespace mu;
@@ -369,13 +371,13 @@ int TimeSigMap::bar2tick(int bar, int beat) const
 {
     // bar - index of current bar (terminology: bar == measure)
     // beat - index of beat in current bar
-    auto e = begin();
 
-    for (; e != end(); ++e) {
-        if (bar < e->second.bar()) {
-            break;
-        }
-    }
+    // bar numbers are precomputed in normalize() and grow with the tick,
+    // so the first event after the bar can be found with a binary search
+    auto e = std::partition_point(begin(), end(), [bar](const value_type& ev) {
+        return ev.second.bar() <= bar;
+    });
+
     if (empty() || e == begin()) {
         LOGD("TimeSigMap::bar2tick(): not found(%d,%d) not found", bar, beat);
         if (empty()) {
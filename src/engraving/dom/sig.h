@@ -22,10 +22,10 @@
 
 #pragma once
 
-#include <map>
 #include <cassert>
 
 #include "global/allocator.h"
+#include "../infrastructure/flatmap.h"
 #include "../types/types.h"
 
 namespace mu::engraving {
@@ -136,7 +136,7 @@ private:
 //   SigList
 //---------------------------------------------------------
 
-class TimeSigMap : public std::map<int, SigEvent>
+class TimeSigMap : public FlatMap<int, SigEvent>
 {
     OBJECT_ALLOCATOR(engraving, TimeSigMap)
 
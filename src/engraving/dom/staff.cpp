@@ -1552,7 +1552,7 @@ void Staff::insertTime(const Fraction& tick, const Fraction& len)
         KeySigEvent kse = i->second;
         Fraction t = Fraction::fromTicks(i->first);
         if (t + len < score()->endTick()) {
-            m_keys.erase(i++);
+            i = m_keys.erase(i);
             kl2[(t + len).ticks()] = kse;
         } else {
             ++i;
@@ -1581,7 +1581,7 @@ void Staff::insertTime(const Fraction& tick, const Fraction& len)
             ++i;
             continue;
         }
-        m_clefs.erase(i++);
+        i = m_clefs.erase(i);
         cl2.setClef((t + len).ticks(), ctl);
     }
     m_clefs.insert(cl2.begin(), cl2.end());
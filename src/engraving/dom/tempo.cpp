@@ -22,9 +22,9 @@
 
 #include "tempo.h"
 
-#include "types/constants.h"
+#include <algorithm>
 
-#include "global/containers.h"
+#include "types/constants.h"
 
 #include "log.h"
 
@@ -56,7 +56,6 @@ void TempoMap::setPause(int tick, double pause)
         insert(std::pair<const int, TEvent>(tick, TEvent(t, pause, TempoType::PAUSE)));
     }
 
-    m_pauses[tick] = pause;
     normalize();
 }
 
@@ -116,16 +115,6 @@ void TempoMap::dump() const
     }
 }
 
-//---------------------------------------------------------
-//   clear
-//---------------------------------------------------------
-
-void TempoMap::clear()
-{
-    std::map<int, TEvent>::clear();
-    m_pauses.clear();
-}
-
 //---------------------------------------------------------
 //   clearRange
 //    Clears the given range, start tick included, end tick
@@ -140,12 +129,6 @@ void TempoMap::clearRange(int tick1, int tick2)
         return;
     }
 
-    if (!m_pauses.empty()) {
-        for (auto it = first; it != last; ++it) {
-            m_pauses.erase(it->first);
-        }
-    }
-
     erase(first, last);
 }
 
@@ -155,20 +138,7 @@ void TempoMap::clearRange(int tick1, int tick2)
 
 BeatsPerSecond TempoMap::tempo(int tick) const
 {
-    if (empty()) {
-        return 2.0;
-    }
-
-    auto i = lower_bound(tick);
-    if (i == end()) {
-        --i;
-        return i->second.tempo;
-    }
-
-    if (i->first == tick) {
-        return i->second.tempo;
-    }
-
+    auto i = upper_bound(tick);
     if (i == begin()) {
         return 2.0;
     }
@@ -184,7 +154,12 @@ BeatsPerSecond TempoMap::multipliedTempo(int tick) const
 
 double TempoMap::pauseSecs(int tick) const
 {
-    return muse::value(m_pauses, tick, 0.0);
+    auto e = find(tick);
+    if (e == end() || !(e->second.type & TempoType::PAUSE)) {
+        return 0.0;
+    }
+
+    return e->second.pause;
 }
 
 BeatsPerSecond TempoMap::tempoMultiplier() const
@@ -229,66 +204,63 @@ void TempoMap::delTempo(int tick)
     normalize();
 }
 
+//---------------------------------------------------------
+//   tick2time
+//    The time of every event is precomputed in normalize(),
+//    so only the last event before tick has to be found
+//---------------------------------------------------------
+
 double TempoMap::tick2time(int tick) const
 {
     double time  = 0.0;
-    double delta = double(tick);
+    int ptick    = 0;
     BeatsPerSecond tempo = 2.0;
 
-    if (!empty()) {
-        int ptick  = 0;
-        auto e = lower_bound(tick);
-        if (e == end()) {
-            auto pe = e;
-            --pe;
-            ptick = pe->first;
-            tempo = pe->second.tempo;
-            time  = pe->second.time;
-        } else if (e->first == tick) {
-            ptick = tick;
-            tempo = e->second.tempo;
-            time  = e->second.time;
-        } else if (e != begin()) {
-            auto pe = e;
-            --pe;
-            ptick = pe->first;
-            tempo = pe->second.tempo;
-            time  = pe->second.time;
-        }
-        delta = double(tick - ptick);
-    } else {
+    if (empty()) {
         LOGD("TempoMap: empty");
     }
 
-    time += delta / (Constants::DIVISION * tempo.val * m_tempoMultiplier.val);
+    auto e = upper_bound(tick);
+    if (e != begin()) {
+        --e;
+        ptick = e->first;
+        tempo = e->second.tempo;
+        time  = e->second.time;
+    }
+
+    time += double(tick - ptick) / (Constants::DIVISION * tempo.val * m_tempoMultiplier.val);
     return time;
 }
 
 //---------------------------------------------------------
 //   time2tick
+//    The precomputed times grow with the ticks,
+//    so the first event at or after time is found
+//    by a binary search
 //---------------------------------------------------------
 
 int TempoMap::time2tick(double time) const
 {
     int tick     = 0;
-    double delta = time;
-    BeatsPerSecond tempo = m_tempo;
+    double delta = 0.0;
+    BeatsPerSecond tempo = 2.0;
 
-    delta = 0.0;
-    tempo = 2.0;
-    for (auto e = begin(); e != end(); ++e) {
-        // if in a pause period, wait on previous tick
-        if ((time <= e->second.time) && (time > e->second.time - e->second.pause)) {
-            delta = (time - (e->second.time - e->second.pause) + delta);
-            break;
-        }
-        if (e->second.time >= time) {
-            break;
-        }
-        delta = e->second.time;
-        tick  = e->first;
-        tempo = e->second.tempo;
+    auto e = std::partition_point(begin(), end(), [time](const value_type& event) {
+        return event.second.time < time;
+    });
+
+    if (e != begin()) {
+        auto prev = std::prev(e);
+        delta = prev->second.time;
+        tick  = prev->first;
+        tempo = prev->second.tempo;
     }
+
+    // if in a pause period, wait on previous tick
+    if (e != end() && time > e->second.time - e->second.pause) {
+        delta = (time - (e->second.time - e->second.pause) + delta);
+    }
+
     delta = time - delta;
     tick += lrint(delta * m_tempoMultiplier.val * Constants::DIVISION * tempo.val);
 
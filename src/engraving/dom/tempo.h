@@ -21,12 +21,10 @@
  */
 #pragma once
 
-#include <map>
-#include <unordered_map>
-
 #include "global/allocator.h"
 #include "types/flags.h"
 
+#include "../infrastructure/flatmap.h"
 #include "../types/bps.h"
 
 namespace mu::engraving {
@@ -43,7 +41,7 @@ struct TEvent {
     TempoTypes type = TempoType::INVALID;
     BeatsPerSecond tempo = 0.0;
     double pause = 0.0; // pause in seconds
-    double time = 0.0;  // precomputed time for tick in sec
+    double time = 0.0;  // precomputed time for tick in sec (cumulative, including the pause)
 
     TEvent() = default;
     TEvent(BeatsPerSecond, double pauseInSeconds, TempoType);
@@ -58,14 +56,13 @@ struct TEvent {
     }
 };
 
-class TempoMap : public std::map<int, TEvent>
+class TempoMap : public FlatMap<int, TEvent>
 {
     OBJECT_ALLOCATOR(engraving, TempoMap)
 
 public:
     TempoMap() = default;
 
-    void clear();
     void clearRange(int tick1, int tick2);
 
     void dump() const;
@@ -89,7 +86,5 @@ private:
 
     BeatsPerSecond m_tempo = 2.0; // tempo if not using tempo list (beats per second)
     BeatsPerSecond m_tempoMultiplier = 1.0;
-
-    std::unordered_map<int, double> m_pauses;
 };
 }
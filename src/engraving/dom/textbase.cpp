@@ -50,6 +50,7 @@
 #include "score.h"
 
 #include "../editing/textedit.h"
+#include "../infrastructure/glyphmetricscache.h"
 
 #include "log.h"
 
@@ -283,10 +284,8 @@ RectF TextCursor::cursorRect() const
         // Ensure the cursor height matches that of the associated text font
         TextLayout::substituteMusicFont(_font, fragment->calculatedFontSize(m_text));
     }
-    const FontMetrics fm(_font);
-
-    double fontCapHeight = fm.capHeight();
-    double fontAscent = fm.ascent();
+    double fontCapHeight = GlyphMetricsCache::capHeight(_font);
+    double fontAscent = GlyphMetricsCache::ascent(_font);
 
     // Bravura Text returns small values for its cap heights
     double cursorCapHeight = fontCapHeight > 0 && _font.family().id() != u"Bravura Text"
@@ -1119,12 +1118,12 @@ int TextBlock::column(double x, TextBase* t) const
             return col;
         }
         double px = 0.0;
+        const FontMetrics fm(f.font(t));
         for (size_t i = 0; i < f.text.size(); ++i) {
             ++idx;
             if (f.text.at(i).isHighSurrogate()) {
                 continue;
             }
-            FontMetrics fm(f.font(t));
             double xo = fm.width(f.text.left(idx));
             if (x <= f.pos.x() + px + (xo - px) * .5) {
                 return col;
@@ -1858,9 +1857,9 @@ void TextBase::layoutFrame(LayoutData* ldata) const
 //      if (empty()) {    // or bbox.width() <= 1.0
     if (ldata->bbox().width() <= 1.0 || ldata->bbox().height() < 1.0) {      // or bbox.width() <= 1.0
         // this does not work for Harmony:
-        FontMetrics fm(font());
-        double ch = fm.ascent();
-        double cw = fm.width('n');
+        const Font f = font();
+        double ch = GlyphMetricsCache::ascent(f);
+        double cw = GlyphMetricsCache::horizontalAdvance(f, U'n');
         ldata->frame = RectF(0.0, -ch, cw, ch);
     } else {
         ldata->frame = ldata->bbox();
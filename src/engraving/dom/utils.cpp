@@ -1335,94 +1335,106 @@ std::vector<EngravingItem*> collectSystemObjects(const Score* score, const std::
 
 std::unordered_set<EngravingItem*> collectElementsAnchoredToChordRest(const ChordRest* cr)
 {
-    std::unordered_set<EngravingItem*> elems;
+    std::vector<EngravingItem*> elems;
+    collectElementsAnchoredToChordRest(cr, elems);
+    return std::unordered_set<EngravingItem*>(elems.begin(), elems.end());
+}
+
+//! NOTE Appends to elems, so that a caller can reuse one buffer; the anchored elements are distinct objects
+void collectElementsAnchoredToChordRest(const ChordRest* cr, std::vector<EngravingItem*>& elems)
+{
     for (EngravingItem* lyric : cr->lyrics()) {
-        elems.emplace(lyric);
+        elems.push_back(lyric);
     }
     if (!cr->isChord()) {
-        return elems;
+        return;
     }
     const Chord* chord = toChord(cr);
     if (Arpeggio* arp = chord->arpeggio()) {
-        elems.emplace(arp);
+        elems.push_back(arp);
     }
     if (TremoloTwoChord* tremTwo = chord->tremoloTwoChord()) {
-        elems.emplace(tremTwo);
+        elems.push_back(tremTwo);
     }
     if (TremoloSingleChord* tremSing = chord->tremoloSingleChord()) {
-        elems.emplace(tremSing);
+        elems.push_back(tremSing);
     }
     for (Articulation* art : chord->articulations()) {
-        elems.emplace(art);
+        elems.push_back(art);
     }
     // Chord brackets and chord lines
     for (EngravingItem* e : chord->el()) {
-        elems.emplace(e);
+        elems.push_back(e);
     }
     for (Chord* grace : chord->graceNotes()) {
-        elems.emplace(grace);
+        elems.push_back(grace);
         for (Articulation* gArt : grace->articulations()) {
-            elems.emplace(gArt);
+            elems.push_back(gArt);
         }
         if (TremoloSingleChord* gTremSing = grace->tremoloSingleChord()) {
-            elems.emplace(gTremSing);
+            elems.push_back(gTremSing);
         }
     }
-    return elems;
 }
 
 std::unordered_set<EngravingItem*> collectElementsAnchoredToNote(const Note* note, bool includeForwardTiesSpanners,
                                                                  bool includeBackwardTiesSpanners)
 {
-    std::unordered_set<EngravingItem*> elems;
+    std::vector<EngravingItem*> elems;
+    collectElementsAnchoredToNote(note, includeForwardTiesSpanners, includeBackwardTiesSpanners, elems);
+    return std::unordered_set<EngravingItem*>(elems.begin(), elems.end());
+}
+
+void collectElementsAnchoredToNote(const Note* note, bool includeForwardTiesSpanners, bool includeBackwardTiesSpanners,
+                                   std::vector<EngravingItem*>& elems)
+{
     LaissezVib* lv = note->laissezVib();
     if (lv && !lv->segmentsEmpty()) {
-        elems.emplace(lv);
+        elems.push_back(lv);
     }
     PartialTie* ipt = note->incomingPartialTie();
     if (ipt && !ipt->segmentsEmpty()) {
-        elems.emplace(ipt);
+        elems.push_back(ipt);
     }
     PartialTie* opt = note->outgoingPartialTie();
     if (opt && !opt->segmentsEmpty()) {
-        elems.emplace(opt);
+        elems.push_back(opt);
     }
     // The following is a bit of a hack - addressing properly would require a fingering rework...
     for (EngravingItem* elem : note->el()) {
         if (elem->isFingering()) {
-            elems.emplace(elem);
+            elems.push_back(elem);
         }
     }
     if (includeForwardTiesSpanners) {
         Tie* tieFor = note->tieFor();
         if (tieFor && !tieFor->segmentsEmpty()) {
-            elems.emplace(tieFor);
+            elems.push_back(tieFor);
         }
         for (Spanner* sp : note->spannerFor()) {
             if (sp->segmentsEmpty()) {
                 continue;
             }
-            elems.emplace(sp);
+            elems.push_back(sp);
         }
     }
     if (includeBackwardTiesSpanners) {
         Tie* tieBack = note->tieBack();
         if (tieBack && !tieBack->segmentsEmpty()) {
-            elems.emplace(tieBack);
+            elems.push_back(tieBack);
         }
         for (Spanner* sp : note->spannerBack()) {
             if (sp->segmentsEmpty()) {
                 continue;
             }
-            elems.emplace(sp);
+            elems.push_back(sp);
         }
     }
     const NoteParenthesisInfo* noteParenInfo = note->parenthesisInfo();
     if (noteParenInfo && noteParenInfo->notes().size()) {
-        elems.emplace(noteParenInfo->leftParen());
-        elems.emplace(noteParenInfo->rightParen());
+        elems.push_back(noteParenInfo->leftParen());
+        elems.push_back(noteParenInfo->rightParen());
     }
-    return elems;
 }
 
 bool noteAnchoredSpannerIsInRange(const Spanner* spanner, const Fraction& rangeStart, const Fraction& rangeEnd)
@@ -101,8 +101,11 @@ extern void collectChordsAndRest(Segment* segment, staff_idx_t staffIdx, std::ve
 extern void collectChordsOverlappingRests(Segment* segment, staff_idx_t staffIdx, std::vector<Chord*>& chords);
 extern std::vector<EngravingItem*> collectSystemObjects(const Score* score, const std::vector<Staff*>& staves = {});
 extern std::unordered_set<EngravingItem*> collectElementsAnchoredToChordRest(const ChordRest* cr);
+extern void collectElementsAnchoredToChordRest(const ChordRest* cr, std::vector<EngravingItem*>& elems);
 extern std::unordered_set<EngravingItem*> collectElementsAnchoredToNote(const Note* cr, bool includeForwardTiesSpanners,
                                                                         bool includeBackwardTiesSpanners);
+extern void collectElementsAnchoredToNote(const Note* note, bool includeForwardTiesSpanners, bool includeBackwardTiesSpanners,
+                                          std::vector<EngravingItem*>& elems);
 
 extern MeasureBeat findBeat(const Score* score, int tick);
 
@@ -374,6 +374,8 @@ void MasterScore::startCmd(const TranslatableString& actionName)
 
     // Start collecting low-level undoable operations for a user-visible undoable transaction.
     undoStack()->beginTransaction(this, actionName);
+
+    m_cmdLatency.begin(actionName.str);
 }
 
 //---------------------------------------------------------
@@ -415,6 +417,11 @@ void MasterScore::undoRedo(bool undo, EditData* ed)
     //! 2. for the redo operation, the list of changed elements will be available after redo()
     UndoableTransaction::ChangesInfo changes;
 
+    //! NOTE: the latency of both operations is measured from before the stack is touched,
+    //! so the name of the redone action is read from the transaction that is about to be redone
+    const UndoableTransaction* transaction = undo ? undoStack()->last() : undoStack()->next();
+    m_cmdLatency.begin((undo ? String(u"Undo: ") : String(u"Redo: ")) + transaction->actionName().str);
+
     if (undo) {
         changes = undoStack()->last()->changesInfo(true);
         undoStack()->undo(ed);
@@ -423,12 +430,24 @@ void MasterScore::undoRedo(bool undo, EditData* ed)
         changes = undoStack()->last()->changesInfo(false);
     }
 
+    m_cmdLatency.endEdit();
+
     update(false);
     invalidateRepeatList();    // TODO: flag individual operations
     updateSelection();
 
-    ScoreChanges result = buildScoreChanges(cmdState(), changes);
-    changesChannel().send(result);
+    ScoreChanges result;
+    {
+        CmdLatencyTimer timer(m_cmdLatency, CmdLatencyPhase::BuildChanges);
+        result = buildScoreChanges(cmdState(), changes);
+    }
+
+    {
+        CmdLatencyTimer timer(m_cmdLatency, CmdLatencyPhase::NotifyChanges);
+        changesChannel().send(result);
+    }
+
+    m_cmdLatency.finish();
 }
 
 //---------------------------------------------------------
@@ -458,6 +477,8 @@ void MasterScore::endCmd(bool rollback, bool layoutAllParts)
         rollback = true;
     }
 
+    m_cmdLatency.endEdit();
+
     if (rollback) {
         undoStack()->activeTransaction()->unwind();
     }
@@ -466,6 +487,7 @@ void MasterScore::endCmd(bool rollback, bool layoutAllParts)
 
     ScoreChanges changes;
     if (!rollback) {
+        CmdLatencyTimer timer(m_cmdLatency, CmdLatencyPhase::BuildChanges);
         changes = buildScoreChanges(cmdState(), undoStack()->activeTransaction()->changesInfo());
     }
 
@@ -481,8 +503,12 @@ void MasterScore::endCmd(bool rollback, bool layoutAllParts)
     cmdState().reset();
 
     if (!isCurrentTransactionEmpty && !rollback) {
+        CmdLatencyTimer timer(m_cmdLatency, CmdLatencyPhase::NotifyChanges);
         changesChannel().send(changes);
     }
+
+    //! NOTE Rolled back and empty commands changed nothing, they would only skew the statistics
+    m_cmdLatency.finish(isCurrentTransactionEmpty || rollback);
 }
 
 #ifndef NDEBUG
@@ -521,8 +547,11 @@ void MasterScore::update(bool resetCmdState, bool layoutAllParts)
 
     bool updateAll = false;
     if (m_cmdState.layoutRange()) {
+        CmdLatencyTimer timer(m_cmdLatency, CmdLatencyPhase::Layout);
+
         for (Score* s : scoreList()) {
             if (s != this && !s->isOpen() && scoreList().size() > 1 && !layoutAllParts) {
+                s->addPendingLayoutRange(m_cmdState.startTick(), m_cmdState.endTick());
                 continue;
             }
             s->doLayoutRange(m_cmdState.startTick(), m_cmdState.endTick());
@@ -534,27 +563,31 @@ void MasterScore::update(bool resetCmdState, bool layoutAllParts)
         setUpTempoMap();
     }
 
-    if (updateAll || m_cmdState.updateAll()) {
-        for (Score* s : scoreList()) {
-            for (MuseScoreView* v : s->getViewer()) {
-                v->updateAll();
-            }
-        }
-    } else if (m_cmdState.updateRange()) {
-        // Any score that accumulated a refresh rect via addRefresh() calls dataChanged() on its viewers.
-        for (Score* s : scoreList()) {
-            if (s->refreshRect().isNull()) {
-                continue;
+    {
+        CmdLatencyTimer timer(m_cmdLatency, CmdLatencyPhase::ViewsUpdate);
+
+        if (updateAll || m_cmdState.updateAll()) {
+            for (Score* s : scoreList()) {
+                for (MuseScoreView* v : s->getViewer()) {
+                    v->updateAll();
+                }
             }
-            const std::list<MuseScoreView*>& viewers = s->getViewer();
-            if (!viewers.empty()) {
-                double d = s->style().spatium() * .5;
-                RectF rect = s->refreshRect().adjusted(-d, -d, 2 * d, 2 * d);
-                for (MuseScoreView* v : viewers) {
-                    v->dataChanged(rect);
+        } else if (m_cmdState.updateRange()) {
+            // Any score that accumulated a refresh rect via addRefresh() calls dataChanged() on its viewers.
+            for (Score* s : scoreList()) {
+                if (s->refreshRect().isNull()) {
+                    continue;
+                }
+                const std::list<MuseScoreView*>& viewers = s->getViewer();
+                if (!viewers.empty()) {
+                    double d = s->style().spatium() * .5;
+                    RectF rect = s->refreshRect().adjusted(-d, -d, 2 * d, 2 * d);
+                    for (MuseScoreView* v : viewers) {
+                        v->dataChanged(rect);
+                    }
                 }
+                s->clearRefreshRect();
             }
-            s->clearRefreshRect();
         }
     }
 
@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "cmdlatency.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "global/serialization/json.h"
+
+using namespace mu::engraving;
+
+std::mutex CmdLatencyStats::s_mutex;
+std::map<muse::String, CmdLatencyStats::CommandStats> CmdLatencyStats::s_stats;
+
+//---------------------------------------------------------
+//   CmdLatencyStats
+//---------------------------------------------------------
+
+void CmdLatencyStats::Histogram::add(double ms)
+{
+    ++buckets[bucketIndex(ms)];
+    ++count;
+    totalMs += ms;
+    maxMs = std::max(maxMs, ms);
+}
+
+size_t CmdLatencyStats::bucketIndex(double ms)
+{
+    size_t bucket = 0;
+    double bound = 1.0;
+    while (bucket < BUCKET_COUNT - 1 && ms >= bound) {
+        bound *= 2.0;
+        ++bucket;
+    }
+    return bucket;
+}
+
+double CmdLatencyStats::bucketUpperBoundMs(size_t bucket)
+{
+    if (bucket >= BUCKET_COUNT - 1) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return static_cast<double>(size_t(1) << bucket);
+}
+
+const char* CmdLatencyStats::phaseName(CmdLatencyPhase phase)
+{
+    switch (phase) {
+    case CmdLatencyPhase::Edit: return "edit";
+    case CmdLatencyPhase::Layout: return "layout";
+    case CmdLatencyPhase::ViewsUpdate: return "viewsUpdate";
+    case CmdLatencyPhase::BuildChanges: return "buildChanges";
+    case CmdLatencyPhase::NotifyChanges: return "notifyChanges";
+    case CmdLatencyPhase::Total: return "total";
+    case CmdLatencyPhase::Count: break;
+    }
+    return "";
+}
+
+void CmdLatencyStats::addSample(const muse::String& actionName, const PhaseTimes& times)
+{
+    std::lock_guard lock(s_mutex);
+    CommandStats& cmd = s_stats[actionName];
+    for (size_t i = 0; i < PHASE_COUNT; ++i) {
+        cmd.phases[i].add(times[i]);
+    }
+}
+
+std::map<muse::String, CmdLatencyStats::CommandStats> CmdLatencyStats::stats()
+{
+    std::lock_guard lock(s_mutex);
+    return s_stats;
+}
+
+void CmdLatencyStats::clear()
+{
+    std::lock_guard lock(s_mutex);
+    s_stats.clear();
+}
+
+muse::ByteArray CmdLatencyStats::toJson()
+{
+    const std::map<muse::String, CommandStats> snapshot = stats();
+
+    muse::JsonArray commandsArray;
+    for (const auto& [actionName, cmd] : snapshot) {
+        muse::JsonObject cmdObj;
+        cmdObj["action"] = actionName.toStdString();
+        cmdObj["count"] = static_cast<int>(cmd.phase(CmdLatencyPhase::Total).count);
+
+        muse::JsonObject phasesObj;
+        for (size_t i = 0; i < PHASE_COUNT; ++i) {
+            const Histogram& h = cmd.phases[i];
+
+            muse::JsonObject phaseObj;
+            phaseObj["totalMs"] = h.totalMs;
+            phaseObj["averageMs"] = h.averageMs();
+            phaseObj["maxMs"] = h.maxMs;
+
+            muse::JsonArray bucketsArray;
+            for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+                bucketsArray << static_cast<int>(h.buckets[b]);
+            }
+            phaseObj["buckets"] = bucketsArray;
+
+            phasesObj[phaseName(static_cast<CmdLatencyPhase>(i))] = phaseObj;
+        }
+        cmdObj["phases"] = phasesObj;
+
+        commandsArray << cmdObj;
+    }
+
+    muse::JsonArray boundsArray;
+    for (size_t b = 0; b < BUCKET_COUNT - 1; ++b) {
+        boundsArray << bucketUpperBoundMs(b);
+    }
+
+    muse::JsonObject rootObj;
+    rootObj["bucketUpperBoundsMs"] = boundsArray;
+    rootObj["commands"] = commandsArray;
+
+    return muse::JsonDocument(rootObj).toJson();
+}
+
+//---------------------------------------------------------
+//   CmdLatencyRecorder
+//---------------------------------------------------------
+
+void CmdLatencyRecorder::begin(const muse::String& actionName)
+{
+    m_active = true;
+    m_actionName = actionName;
+    m_start = Clock::now();
+    m_times.fill(0.0);
+}
+
+void CmdLatencyRecorder::endEdit()
+{
+    if (!m_active) {
+        return;
+    }
+
+    //! NOTE Commands may lay out and update the views on their own before endCmd,
+    //! that time is already accounted in the corresponding phases
+    const std::chrono::duration<double, std::milli> elapsed = Clock::now() - m_start;
+    const double nested = m_times[static_cast<size_t>(CmdLatencyPhase::Layout)]
+                          + m_times[static_cast<size_t>(CmdLatencyPhase::ViewsUpdate)];
+    m_times[static_cast<size_t>(CmdLatencyPhase::Edit)] = std::max(0.0, elapsed.count() - nested);
+}
+
+void CmdLatencyRecorder::addTime(CmdLatencyPhase phase, double ms)
+{
+    if (!m_active) {
+        return;
+    }
+
+    m_times[static_cast<size_t>(phase)] += ms;
+}
+
+void CmdLatencyRecorder::finish(bool discard)
+{
+    if (!m_active) {
+        return;
+    }
+
+    m_active = false;
+
+    if (discard) {
+        return;
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed = Clock::now() - m_start;
+    m_times[static_cast<size_t>(CmdLatencyPhase::Total)] = elapsed.count();
+
+    CmdLatencyStats::addSample(m_actionName, m_times);
+}
@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <mutex>
+
+#include "global/types/bytearray.h"
+#include "global/types/string.h"
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   CmdLatencyPhase
+//---------------------------------------------------------
+
+enum class CmdLatencyPhase {
+    Edit = 0,       ///< DOM mutation, from startCmd to endCmd
+    Layout,         ///< layout of the changed range in all laid out scores
+    ViewsUpdate,    ///< updateAll/dataChanged notifications of the viewers
+    BuildChanges,   ///< building ScoreChanges from the transaction
+    NotifyChanges,  ///< changes channel subscribers (notation, playback model, ...)
+    Total,          ///< from startCmd (or undo/redo) to the end of endCmd
+
+    Count
+};
+
+//---------------------------------------------------------
+//   CmdLatencyStats
+//    process-wide per-command latency histograms
+//---------------------------------------------------------
+
+class CmdLatencyStats
+{
+public:
+    static constexpr size_t PHASE_COUNT = static_cast<size_t>(CmdLatencyPhase::Count);
+    static constexpr size_t BUCKET_COUNT = 12; // <1, <2, <4 ... <1024 ms, >=1024 ms
+
+    using PhaseTimes = std::array<double, PHASE_COUNT>; // ms
+
+    struct Histogram {
+        std::array<size_t, BUCKET_COUNT> buckets = {};
+        size_t count = 0;
+        double totalMs = 0.0;
+        double maxMs = 0.0;
+
+        void add(double ms);
+        double averageMs() const { return count ? totalMs / count : 0.0; }
+    };
+
+    struct CommandStats {
+        std::array<Histogram, PHASE_COUNT> phases;
+
+        const Histogram& phase(CmdLatencyPhase p) const { return phases.at(static_cast<size_t>(p)); }
+    };
+
+    static void addSample(const muse::String& actionName, const PhaseTimes& times);
+    static std::map<muse::String, CommandStats> stats();
+    static void clear();
+
+    static muse::ByteArray toJson();
+
+    static const char* phaseName(CmdLatencyPhase phase);
+    static size_t bucketIndex(double ms);
+    static double bucketUpperBoundMs(size_t bucket);
+
+private:
+    static std::mutex s_mutex;
+    static std::map<muse::String, CommandStats> s_stats;
+};
+
+//---------------------------------------------------------
+//   CmdLatencyRecorder
+//    collects the phase times of the current command of a master score
+//---------------------------------------------------------
+
+class CmdLatencyRecorder
+{
+public:
+    void begin(const muse::String& actionName);
+    void endEdit();
+    void addTime(CmdLatencyPhase phase, double ms);
+    void finish(bool discard = false);
+
+    bool isActive() const { return m_active; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    bool m_active = false;
+    muse::String m_actionName;
+    Clock::time_point m_start;
+    CmdLatencyStats::PhaseTimes m_times = {};
+};
+
+//---------------------------------------------------------
+//   CmdLatencyTimer
+//    adds the lifetime of the object to a phase of the current command
+//---------------------------------------------------------
+
+class CmdLatencyTimer
+{
+public:
+    CmdLatencyTimer(CmdLatencyRecorder& recorder, CmdLatencyPhase phase)
+        : m_recorder(recorder), m_phase(phase), m_start(std::chrono::steady_clock::now()) {}
+
+    ~CmdLatencyTimer()
+    {
+        if (m_recorder.isActive()) {
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_start;
+            m_recorder.addTime(m_phase, elapsed.count());
+        }
+    }
+
+private:
+    CmdLatencyRecorder& m_recorder;
+    CmdLatencyPhase m_phase;
+    std::chrono::steady_clock::time_point m_start;
+};
+}
@@ -22,6 +22,8 @@
 
 #include "editproperty.h"
 
+#include <typeinfo>
+
 #include "../dom/bracketItem.h"
 #include "../dom/score.h"
 #include "../dom/staff.h"
@@ -55,6 +57,23 @@ std::vector<EngravingObject*> ChangeProperty::objectItems() const
     return compoundObjects(element);
 }
 
+bool ChangeProperty::mergeWith(const UndoableCommand* next)
+{
+    //! NOTE Subclasses flip more than the property itself, so only plain changes are merged
+    if (typeid(*this) != typeid(ChangeProperty) || typeid(*next) != typeid(ChangeProperty)) {
+        return false;
+    }
+
+    const ChangeProperty* nextChange = static_cast<const ChangeProperty*>(next);
+    if (nextChange->element != element || nextChange->id != id) {
+        return false;
+    }
+
+    // This command keeps the value from before the first change, which is what undo has to restore;
+    // redo takes the latest value from the element
+    return true;
+}
+
 //---------------------------------------------------------
 //   ChangeBracketProperty::flip
 //---------------------------------------------------------
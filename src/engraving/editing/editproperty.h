@@ -55,6 +55,8 @@ public:
     {
         return f == UndoableCommandFilter::ChangePropertyLinked && muse::contains(target->linkList(), element);
     }
+
+    bool mergeWith(const UndoableCommand* next) override;
 };
 
 class ChangeBracketProperty : public ChangeProperty
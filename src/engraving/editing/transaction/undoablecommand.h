@@ -183,6 +183,10 @@ public:
 
     virtual bool matchesFilter(UndoableCommandFilter, const EngravingItem* /* target */) const { return false; }
 
+    //! NOTE Absorbs the command performed right after this one, if both can be undone as one step.
+    //! On success the caller deletes the absorbed command.
+    virtual bool mergeWith(const UndoableCommand* /* next */) { return false; }
+
 protected:
     virtual void flip(EditData*) {}
 };
@@ -36,6 +36,8 @@
 
 #include "containers.h"
 
+#include "dom/score.h"
+
 #include "editing/editproperty.h"
 #include "editing/editstyle.h"
 #include "editing/textedit.h"
@@ -150,6 +152,7 @@ void UndoStack::pushAndPerform(UndoableCommand* cmd, EditData* ed)
 #endif
     m_activeTransaction->appendCommand(cmd);
     cmd->redo(ed);
+    markChanged(cmd);
 }
 
 void UndoStack::pushWithoutPerforming(UndoableCommand* cmd)
@@ -162,6 +165,22 @@ void UndoStack::pushWithoutPerforming(UndoableCommand* cmd)
         return;
     }
     m_activeTransaction->appendCommand(cmd);
+    markChanged(cmd);
+}
+
+void UndoStack::markChanged(const UndoableCommand* cmd)
+{
+    bool attributed = false;
+    for (EngravingObject* object : cmd->objectItems()) {
+        if (object && object->score()) {
+            object->score()->markChanged();
+            attributed = true;
+        }
+    }
+
+    if (!attributed) {
+        ++m_unattributedChangesRevision;
+    }
 }
 
 void UndoStack::remove(size_t idx)
@@ -187,7 +206,13 @@ void UndoStack::remove(size_t idx)
 
 void UndoStack::mergeTransactions(size_t startIdx)
 {
-    assert(startIdx <= m_currentIndex);
+    assert(startIdx <= currentIndex());
+
+    if (startIdx < m_droppedCount) {
+        LOGD() << "merge start " << startIdx << " was dropped from the history, merging from " << m_droppedCount;
+        startIdx = m_droppedCount;
+    }
+    startIdx -= m_droppedCount;
 
     if (startIdx >= m_transactions.size()) {
         return;
@@ -222,11 +247,56 @@ void UndoStack::endTransaction(bool rollback)
             transaction->cleanup(false); // delete elements for which UndoableCommand() holds ownership
             delete transaction;
         }
+        m_activeTransaction->compact();
         m_transactions.push_back(m_activeTransaction);
         m_states.push_back(m_nextState++);
         ++m_currentIndex;
     }
     m_activeTransaction = nullptr;
+
+    if (!rollback && configuration()) {
+        trimHistory(configuration()->undoHistoryCommandsLimit());
+    }
+}
+
+//! NOTE Drops the oldest done transactions while the history holds more commands than the limit (0 means unlimited).
+//! The most recent transactions are always kept, as callers merge them right after ending a command.
+//! The public indices don't shift (see currentIndex), as the dropped transactions are counted in m_droppedCount.
+void UndoStack::trimHistory(size_t commandsLimit)
+{
+    static constexpr size_t MIN_KEPT_TRANSACTIONS = 2;
+
+    if (commandsLimit == 0 || m_activeTransaction || m_currentIndex <= MIN_KEPT_TRANSACTIONS) {
+        return;
+    }
+
+    size_t commandsCount = 0;
+    for (const UndoableTransaction* transaction : m_transactions) {
+        commandsCount += transaction->commands().size();
+    }
+
+    size_t dropCount = 0;
+    while (commandsCount > commandsLimit && dropCount + MIN_KEPT_TRANSACTIONS < m_currentIndex) {
+        commandsCount -= m_transactions[dropCount]->commands().size();
+        ++dropCount;
+    }
+
+    if (dropCount == 0) {
+        return;
+    }
+
+    for (size_t idx = 0; idx < dropCount; ++idx) {
+        UndoableTransaction* transaction = m_transactions[idx];
+        transaction->cleanup(true); // delete elements for which UndoableCommand() holds ownership
+        delete transaction;
+    }
+
+    m_transactions.erase(m_transactions.begin(), m_transactions.begin() + dropCount);
+    m_states.erase(m_states.begin(), m_states.begin() + dropCount);
+    m_currentIndex -= dropCount;
+    m_droppedCount += dropCount;
+
+    LOGD() << "dropped " << dropCount << " oldest transactions, commands left: " << commandsCount;
 }
 
 void UndoStack::reopen()
@@ -252,7 +322,7 @@ void UndoStack::undo(EditData* ed)
     // Are we currently editing text?
     if (ed && ed->element && ed->element->isTextBase()) {
         TextEditData* ted = dynamic_cast<TextEditData*>(ed->getData(ed->element).get());
-        if (ted && ted->startUndoIdx == m_currentIndex) {
+        if (ted && ted->startUndoIdx == currentIndex()) {
             // No edits to undo, so do nothing
             return;
         }
@@ -261,6 +331,10 @@ void UndoStack::undo(EditData* ed)
         --m_currentIndex;
         assert(m_currentIndex < m_transactions.size());
         m_transactions[m_currentIndex]->undo(ed);
+
+        for (const UndoableCommand* cmd : m_transactions[m_currentIndex]->commands()) {
+            markChanged(cmd);
+        }
     }
 }
 
@@ -268,7 +342,12 @@ void UndoStack::redo(EditData* ed)
 {
     LOG_UNDO() << "called";
     if (canRedo()) {
-        m_transactions[m_currentIndex++]->redo(ed);
+        UndoableTransaction* transaction = m_transactions[m_currentIndex++];
+        transaction->redo(ed);
+
+        for (const UndoableCommand* cmd : transaction->commands()) {
+            markChanged(cmd);
+        }
     }
 }
 
@@ -296,6 +375,26 @@ void UndoableTransaction::cleanup(bool wasDone)
     }
 }
 
+void UndoableTransaction::compact()
+{
+    if (m_commands.size() < 2) {
+        return;
+    }
+
+    std::vector<UndoableCommand*> compacted;
+    compacted.reserve(m_commands.size());
+
+    for (UndoableCommand* command : m_commands) {
+        if (!compacted.empty() && compacted.back()->mergeWith(command)) {
+            delete command;
+            continue;
+        }
+        compacted.push_back(command);
+    }
+
+    m_commands = std::move(compacted);
+}
+
 void UndoableTransaction::unwind()
 {
     while (!m_commands.empty()) {
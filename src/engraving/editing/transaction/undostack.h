@@ -26,6 +26,9 @@
 
 #include "global/containers.h"
 #include "global/types/translatablestring.h"
+#include "modularity/ioc.h"
+
+#include "../../iengravingconfiguration.h"
 
 #include "../../dom/input.h"
 
@@ -54,6 +57,7 @@ public:
 
     void unwind();
     void cleanup(bool wasDone);
+    void compact();
 
     const std::vector<UndoableCommand*>& commands() const { return m_commands; }
     bool empty() const { return m_commands.empty(); }
@@ -111,6 +115,8 @@ private:
 
 class UndoStack
 {
+    muse::GlobalInject<IEngravingConfiguration> configuration;
+
 public:
     UndoStack();
     ~UndoStack();
@@ -130,8 +136,11 @@ public:
     bool canRedo() const { return m_currentIndex < m_transactions.size(); }
     bool isClean() const { return m_cleanState == m_states[m_currentIndex]; }
 
-    size_t size() const { return m_transactions.size(); }
-    size_t currentIndex() const { return m_currentIndex; }
+    //! NOTE Indices count from the start of the history, including the transactions dropped by trimHistory,
+    //! so an index kept by a caller (e.g. the start of a text edit) still addresses the same state after trimming
+    size_t size() const { return m_droppedCount + m_transactions.size(); }
+    size_t currentIndex() const { return m_droppedCount + m_currentIndex; }
+    size_t firstIndex() const { return m_droppedCount; }
 
     UndoableTransaction* activeTransaction() const { return m_activeTransaction; }
 
@@ -144,7 +153,8 @@ public:
     /// https://github.com/musescore/MuseScore/pull/25389#discussion_r1825782176
     UndoableTransaction* lastAtIndex(size_t idx) const
     {
-        return idx > 0 && idx - 1 < m_transactions.size() ? m_transactions[idx - 1] : nullptr;
+        return idx > m_droppedCount && idx - m_droppedCount - 1 < m_transactions.size()
+               ? m_transactions[idx - m_droppedCount - 1] : nullptr;
     }
 
     void undo(EditData*);
@@ -152,10 +162,16 @@ public:
     void reopen();
 
     void mergeTransactions(size_t startIdx);
+    void trimHistory(size_t commandsLimit);
     void cleanRedoStack() { remove(m_currentIndex); }
 
+    //! NOTE Counts the performed, undone and redone commands that don't name the objects they change,
+    //! so they can't be attributed to a score (see Score::changesRevision)
+    size_t unattributedChangesRevision() const { return m_unattributedChangesRevision; }
+
 private:
     void remove(size_t idx);
+    void markChanged(const UndoableCommand* cmd);
 
     UndoableTransaction* m_activeTransaction = nullptr;
     std::vector<UndoableTransaction*> m_transactions;
@@ -163,6 +179,8 @@ private:
     int m_nextState = 0;
     int m_cleanState = 0;
     size_t m_currentIndex = 0;
+    size_t m_droppedCount = 0;
     bool m_isLocked = false;
+    size_t m_unattributedChangesRevision = 0;
 };
 }
@@ -127,6 +127,7 @@ void EngravingModule::resolveImports()
         ir->registerQmlUri(Uri("musescore://diagnostics/engraving/elements"), "MuseScore.Engraving", "EngravingElementsDialog");
         ir->registerQmlUri(Uri("musescore://diagnostics/engraving/undostack"), "MuseScore.Engraving", "EngravingUndoStackDialog");
         ir->registerQmlUri(Uri("musescore://diagnostics/engraving/style"), "MuseScore.Engraving", "EngravingStyleDialog");
+        ir->registerQmlUri(Uri("musescore://diagnostics/engraving/cmdlatency"), "MuseScore.Engraving", "EngravingCmdLatencyDialog");
     }
 #endif
 }
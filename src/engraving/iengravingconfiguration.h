@@ -134,6 +134,9 @@ public:
 
     virtual bool allowReadingImagesFromOutsideMscz() const = 0;
 
+    virtual size_t undoHistoryCommandsLimit() const = 0;
+    virtual void setUndoHistoryCommandsLimit(size_t limit) = 0;
+
     /// these configurations will be removed after solving https://github.com/musescore/MuseScore/issues/14294
     virtual bool guitarProImportExperimental() const = 0;
     virtual bool negativeFretsAllowed() const = 0;
@@ -0,0 +1,233 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   FlatMap
+//    Ordered map stored as a sorted vector of (key, value) pairs.
+//    The interface follows std::map, so it can replace it
+//    for small, lookup-heavy maps keyed by tick.
+//
+//    Unlike std::map, inserting or erasing invalidates all
+//    iterators and references to the elements; use the
+//    iterator returned by erase() when removing in a loop.
+//---------------------------------------------------------
+
+template<typename Key, typename T>
+class FlatMap
+{
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using container_type = std::vector<value_type>;
+    using size_type = typename container_type::size_type;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+    using reverse_iterator = typename container_type::reverse_iterator;
+    using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+    FlatMap() = default;
+    FlatMap(std::initializer_list<value_type> list)
+    {
+        for (const value_type& v : list) {
+            insert_or_assign(v.first, v.second);
+        }
+    }
+
+    iterator begin() { return m_data.begin(); }
+    const_iterator begin() const { return m_data.begin(); }
+    const_iterator cbegin() const { return m_data.cbegin(); }
+    iterator end() { return m_data.end(); }
+    const_iterator end() const { return m_data.end(); }
+    const_iterator cend() const { return m_data.cend(); }
+    reverse_iterator rbegin() { return m_data.rbegin(); }
+    const_reverse_iterator rbegin() const { return m_data.rbegin(); }
+    const_reverse_iterator crbegin() const { return m_data.crbegin(); }
+    reverse_iterator rend() { return m_data.rend(); }
+    const_reverse_iterator rend() const { return m_data.rend(); }
+    const_reverse_iterator crend() const { return m_data.crend(); }
+
+    bool empty() const { return m_data.empty(); }
+    size_type size() const { return m_data.size(); }
+    void clear() { m_data.clear(); }
+    void reserve(size_type n) { m_data.reserve(n); }
+
+    iterator lower_bound(const Key& key) { return begin() + lowerBoundIndex(key); }
+    const_iterator lower_bound(const Key& key) const { return begin() + lowerBoundIndex(key); }
+    iterator upper_bound(const Key& key) { return begin() + upperBoundIndex(key); }
+    const_iterator upper_bound(const Key& key) const { return begin() + upperBoundIndex(key); }
+
+    std::pair<iterator, iterator> equal_range(const Key& key) { return { lower_bound(key), upper_bound(key) }; }
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const { return { lower_bound(key), upper_bound(key) }; }
+
+    iterator find(const Key& key)
+    {
+        iterator it = lower_bound(key);
+        return (it != end() && !(key < it->first)) ? it : end();
+    }
+
+    const_iterator find(const Key& key) const
+    {
+        const_iterator it = lower_bound(key);
+        return (it != end() && !(key < it->first)) ? it : end();
+    }
+
+    bool contains(const Key& key) const { return find(key) != end(); }
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    T& at(const Key& key)
+    {
+        iterator it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("FlatMap::at");
+        }
+        return it->second;
+    }
+
+    const T& at(const Key& key) const
+    {
+        const_iterator it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("FlatMap::at");
+        }
+        return it->second;
+    }
+
+    T& operator[](const Key& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    template<typename ... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        iterator it = lower_bound(key);
+        if (it != end() && !(key < it->first)) {
+            return { it, false };
+        }
+
+        it = m_data.emplace(it, std::piecewise_construct, std::forward_as_tuple(key),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+        return { it, true };
+    }
+
+    template<typename V>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value)
+    {
+        auto result = try_emplace(key, std::forward<V>(value));
+        if (!result.second) {
+            result.first->second = std::forward<V>(value);
+        }
+        return result;
+    }
+
+    //! NOTE Like std::map::insert, an existing value for the key is kept
+    template<typename P>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return try_emplace(value.first, std::forward<P>(value).second);
+    }
+
+    template<typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first) {
+            try_emplace(first->first, first->second);
+        }
+    }
+
+    template<typename ... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    iterator erase(const_iterator pos) { return m_data.erase(pos); }
+    iterator erase(iterator pos) { return m_data.erase(pos); }
+    iterator erase(const_iterator first, const_iterator last) { return m_data.erase(first, last); }
+
+    size_type erase(const Key& key)
+    {
+        iterator it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+
+        m_data.erase(it);
+        return 1;
+    }
+
+    bool operator==(const FlatMap& other) const { return m_data == other.m_data; }
+    bool operator!=(const FlatMap& other) const { return !(*this == other); }
+
+private:
+    //! NOTE Branch-free binary search: the loop always runs log2(n) times
+    //! and the comparison result only selects the next base (a conditional move),
+    //! so lookups in small maps don't suffer from branch mispredictions
+    size_type lowerBoundIndex(const Key& key) const
+    {
+        size_type len = m_data.size();
+        if (len == 0) {
+            return 0;
+        }
+
+        const value_type* first = m_data.data();
+        const value_type* base = first;
+        while (len > 1) {
+            const size_type half = len / 2;
+            base = (base[half - 1].first < key) ? base + half : base;
+            len -= half;
+        }
+
+        return static_cast<size_type>(base - first) + ((base->first < key) ? 1 : 0);
+    }
+
+    size_type upperBoundIndex(const Key& key) const
+    {
+        size_type len = m_data.size();
+        if (len == 0) {
+            return 0;
+        }
+
+        const value_type* first = m_data.data();
+        const value_type* base = first;
+        while (len > 1) {
+            const size_type half = len / 2;
+            base = (key < base[half - 1].first) ? base : base + half;
+            len -= half;
+        }
+
+        return static_cast<size_type>(base - first) + ((key < base->first) ? 0 : 1);
+    }
+
+    container_type m_data;
+};
+}
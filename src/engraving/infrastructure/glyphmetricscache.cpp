@@ -0,0 +1,163 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "glyphmetricscache.h"
+
+#include <mutex>
+
+#include "draw/fontmetrics.h"
+
+using namespace mu::engraving;
+using namespace muse;
+using namespace muse::draw;
+
+std::shared_mutex GlyphMetricsCache::s_mutex;
+std::map<GlyphMetricsCache::FontKey, GlyphMetricsCache::FontEntry> GlyphMetricsCache::s_fonts;
+
+bool GlyphMetricsCache::FontKey::operator<(const FontKey& other) const
+{
+    if (pointSize != other.pointSize) {
+        return pointSize < other.pointSize;
+    }
+    if (type != other.type) {
+        return type < other.type;
+    }
+    if (weight != other.weight) {
+        return weight < other.weight;
+    }
+    if (italic != other.italic) {
+        return italic < other.italic;
+    }
+    if (noFontMerging != other.noFontMerging) {
+        return noFontMerging < other.noFontMerging;
+    }
+    return family < other.family;
+}
+
+GlyphMetricsCache::FontKey GlyphMetricsCache::fontKey(const Font& font)
+{
+    FontKey key;
+    key.family = font.family().id();
+    key.type = static_cast<int>(font.type());
+    key.pointSize = font.pointSizeF();
+    key.weight = static_cast<int>(font.weight());
+    key.italic = font.italic();
+    key.noFontMerging = font.noFontMerging();
+    return key;
+}
+
+//! NOTE Must be called with the unique lock held
+GlyphMetricsCache::FontEntry& GlyphMetricsCache::fontEntry(const FontKey& key)
+{
+    auto it = s_fonts.find(key);
+    if (it != s_fonts.end()) {
+        return it->second;
+    }
+
+    if (s_fonts.size() >= MAX_FONTS) {
+        s_fonts.clear();
+    }
+
+    return s_fonts.emplace(key, FontEntry()).first->second;
+}
+
+//! NOTE Misses are measured outside of the lock, so that other threads are not blocked by the font engine
+GlyphMetricsCache::GlyphMetrics GlyphMetricsCache::glyphMetrics(const Font& font, char32_t code)
+{
+    const FontKey key = fontKey(font);
+
+    {
+        std::shared_lock lock(s_mutex);
+        auto fontIt = s_fonts.find(key);
+        if (fontIt != s_fonts.end()) {
+            auto glyphIt = fontIt->second.glyphs.find(code);
+            if (glyphIt != fontIt->second.glyphs.end()) {
+                return glyphIt->second;
+            }
+        }
+    }
+
+    const String text = String::fromUcs4(code);
+    const FontMetrics fm(font);
+    GlyphMetrics metrics;
+    metrics.advance = fm.horizontalAdvance(text);
+    metrics.tightBoundingRect = fm.tightBoundingRect(text);
+
+    std::unique_lock lock(s_mutex);
+    fontEntry(key).glyphs.emplace(code, metrics);
+    return metrics;
+}
+
+double GlyphMetricsCache::horizontalAdvance(const Font& font, char32_t code)
+{
+    return glyphMetrics(font, code).advance;
+}
+
+RectF GlyphMetricsCache::tightBoundingRect(const Font& font, char32_t code)
+{
+    return glyphMetrics(font, code).tightBoundingRect;
+}
+
+GlyphMetricsCache::LineMetrics GlyphMetricsCache::lineMetrics(const Font& font)
+{
+    const FontKey key = fontKey(font);
+
+    {
+        std::shared_lock lock(s_mutex);
+        auto it = s_fonts.find(key);
+        if (it != s_fonts.end() && it->second.hasLineMetrics) {
+            return it->second.lineMetrics;
+        }
+    }
+
+    LineMetrics metrics;
+    metrics.ascent = FontMetrics::ascent(font);
+    metrics.capHeight = FontMetrics::capHeight(font);
+
+    std::unique_lock lock(s_mutex);
+    FontEntry& entry = fontEntry(key);
+    entry.lineMetrics = metrics;
+    entry.hasLineMetrics = true;
+    return metrics;
+}
+
+double GlyphMetricsCache::ascent(const Font& font)
+{
+    return lineMetrics(font).ascent;
+}
+
+double GlyphMetricsCache::capHeight(const Font& font)
+{
+    return lineMetrics(font).capHeight;
+}
+
+void GlyphMetricsCache::clear()
+{
+    std::unique_lock lock(s_mutex);
+    s_fonts.clear();
+}
+
+size_t GlyphMetricsCache::fontsCount()
+{
+    std::shared_lock lock(s_mutex);
+    return s_fonts.size();
+}
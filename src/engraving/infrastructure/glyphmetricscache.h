@@ -0,0 +1,90 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <map>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "draw/types/font.h"
+#include "draw/types/geometry.h"
+
+namespace mu::engraving {
+//! NOTE Process-wide cache of per-glyph metrics used by text layout.
+//! Measuring a single character through FontMetrics goes through the font engine every time,
+//! which dominates layout of text-heavy scores (lyrics in particular). The results only depend
+//! on the font and the code point, so they are computed once and shared between all scores.
+//! Safe to use from several layout threads at once.
+class GlyphMetricsCache
+{
+public:
+    struct GlyphMetrics {
+        double advance = 0.0;
+        muse::RectF tightBoundingRect;
+    };
+
+    static GlyphMetrics glyphMetrics(const muse::draw::Font& font, char32_t code);
+    static double horizontalAdvance(const muse::draw::Font& font, char32_t code);
+    static muse::RectF tightBoundingRect(const muse::draw::Font& font, char32_t code);
+
+    static double ascent(const muse::draw::Font& font);
+    static double capHeight(const muse::draw::Font& font);
+
+    static void clear();
+    static size_t fontsCount();
+
+private:
+    struct FontKey {
+        muse::String family;
+        int type = 0;
+        double pointSize = 0.0;
+        int weight = 0;
+        bool italic = false;
+        bool noFontMerging = false;
+
+        bool operator<(const FontKey& other) const;
+    };
+
+    struct LineMetrics {
+        double ascent = 0.0;
+        double capHeight = 0.0;
+    };
+
+    struct FontEntry {
+        bool hasLineMetrics = false;
+        LineMetrics lineMetrics;
+        std::unordered_map<char32_t, GlyphMetrics> glyphs;
+    };
+
+    static FontKey fontKey(const muse::draw::Font& font);
+    static FontEntry& fontEntry(const FontKey& key);
+    static LineMetrics lineMetrics(const muse::draw::Font& font);
+
+    //! NOTE Font sizes depend on spatium and magnification, so the number of distinct fonts
+    //! is not bounded in practice; the cache is dropped entirely when it grows past this
+    static constexpr size_t MAX_FONTS = 512;
+
+    static std::shared_mutex s_mutex;
+    static std::map<FontKey, FontEntry> s_fonts;
+};
+}
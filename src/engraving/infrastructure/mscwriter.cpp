@@ -71,11 +71,22 @@ const MscWriter::Params& MscWriter::params() const
 
 Ret MscWriter::open()
 {
+    if (m_params.deferred) {
+        m_isDeferredOpened = true;
+        return make_ok();
+    }
+
     return writer()->open(m_params.device, m_params.filePath);
 }
 
 void MscWriter::close()
 {
+    if (m_isDeferredOpened) {
+        writeMeta();
+        m_isDeferredOpened = false;
+        return;
+    }
+
     if (m_writer) {
         if (m_writer->isOpened()) {
             writeMeta();
@@ -90,6 +101,10 @@ void MscWriter::close()
 
 bool MscWriter::isOpened() const
 {
+    if (m_params.deferred) {
+        return m_isDeferredOpened;
+    }
+
     return m_writer ? m_writer->isOpened() : false;
 }
 
@@ -98,6 +113,34 @@ bool MscWriter::hasError() const
     return m_writer ? m_writer->hasError() : m_hadError;
 }
 
+Ret MscWriter::writeDeferredFiles()
+{
+    IF_ASSERT_FAILED(m_params.deferred && !m_isDeferredOpened) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    Ret ret = writer()->open(m_params.device, m_params.filePath);
+    if (!ret) {
+        return ret;
+    }
+
+    for (const auto& file : m_deferredFiles) {
+        if (!m_writer->addFileData(file.first, file.second)) {
+            LOGE() << "failed write file: " << file.first;
+            break;
+        }
+    }
+
+    m_deferredFiles.clear();
+
+    m_writer->close();
+    m_hadError = m_writer->hasError();
+    delete m_writer;
+    m_writer = nullptr;
+
+    return m_hadError ? make_ret(Ret::Code::UnknownError) : make_ok();
+}
+
 MscWriter::IWriter* MscWriter::writer() const
 {
     if (!m_writer) {
@@ -122,6 +165,12 @@ MscWriter::IWriter* MscWriter::writer() const
 
 bool MscWriter::addFileData(const String& fileName, const ByteArray& data)
 {
+    if (m_params.deferred) {
+        m_deferredFiles.emplace_back(fileName, data);
+        m_meta.addFile(fileName);
+        return true;
+    }
+
     if (!writer()->addFileData(fileName, data)) {
         LOGE() << "failed write file: " << fileName;
         return false;
@@ -21,6 +21,9 @@
  */
 #pragma once
 
+#include <vector>
+
+#include "types/bytearray.h"
 #include "types/string.h"
 #include "types/ret.h"
 #include "io/path.h"
@@ -43,6 +46,10 @@ public:
         muse::io::path_t filePath;
         muse::String mainFileName;
         MscIoMode mode = MscIoMode::Zip;
+
+        //! NOTE The files are only collected while the writer is open, and written to the device
+        //! by writeDeferredFiles() after it's closed, which may be called on another thread
+        bool deferred = false;
     };
 
     MscWriter() = default;
@@ -57,6 +64,8 @@ public:
     bool isOpened() const;
     bool hasError() const;
 
+    muse::Ret writeDeferredFiles();
+
     void writeStyleFile(const muse::ByteArray& data);
     void writeScoreFile(const muse::ByteArray& data);
     void addExcerptStyleFile(const muse::String& excerptFileName, const muse::ByteArray& data);
@@ -141,5 +150,8 @@ private:
     mutable IWriter* m_writer = nullptr;
     Meta m_meta;
     bool m_hadError = false;
+
+    bool m_isDeferredOpened = false;
+    std::vector<std::pair<muse::String, muse::ByteArray> > m_deferredFiles;
 };
 }
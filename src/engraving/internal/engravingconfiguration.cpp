@@ -55,6 +55,8 @@ static const Settings::Key FRETBOARD_DIAGRAMS_AUTO_UPDATE("engraving", "score/fr
 
 static const Settings::Key DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT("engraving", "engraving/compat/doNotSaveEIDsForBackCompat");
 
+static const Settings::Key UNDO_HISTORY_COMMANDS_LIMIT("engraving", "engraving/undo/historyCommandsLimit");
+
 struct VoiceColor {
     Settings::Key key;
     Color color;
@@ -157,6 +159,10 @@ void EngravingConfiguration::init()
     settings()->setDefaultValue(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, Val(false));
     settings()->setDescription(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, muse::trc("engraving", "Do not save EIDs"));
     settings()->setCanBeManuallyEdited(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, false);
+
+    settings()->setDefaultValue(UNDO_HISTORY_COMMANDS_LIMIT, Val(0));
+    settings()->setDescription(UNDO_HISTORY_COMMANDS_LIMIT, muse::trc("engraving", "Undo history limit (commands, 0 for unlimited)"));
+    settings()->setCanBeManuallyEdited(UNDO_HISTORY_COMMANDS_LIMIT, true);
 }
 
 muse::io::path_t EngravingConfiguration::appDataPath() const
@@ -440,6 +446,16 @@ bool EngravingConfiguration::allowReadingImagesFromOutsideMscz() const
     return false;
 }
 
+size_t EngravingConfiguration::undoHistoryCommandsLimit() const
+{
+    return static_cast<size_t>(std::max(0, settings()->value(UNDO_HISTORY_COMMANDS_LIMIT).toInt()));
+}
+
+void EngravingConfiguration::setUndoHistoryCommandsLimit(size_t limit)
+{
+    settings()->setSharedValue(UNDO_HISTORY_COMMANDS_LIMIT, Val(static_cast<int>(limit)));
+}
+
 bool EngravingConfiguration::guitarProImportExperimental() const
 {
     return guitarProConfiguration() ? guitarProConfiguration()->experimental() : false;
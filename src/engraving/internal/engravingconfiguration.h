@@ -108,6 +108,9 @@ public:
 
     bool allowReadingImagesFromOutsideMscz() const override;
 
+    size_t undoHistoryCommandsLimit() const override;
+    void setUndoHistoryCommandsLimit(size_t limit) override;
+
     bool guitarProImportExperimental() const override;
     bool negativeFretsAllowed() const override;
     void setGuitarProMultivoiceEnabled(bool multiVoice) override;
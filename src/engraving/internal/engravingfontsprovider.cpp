@@ -24,6 +24,8 @@
 
 #include "global/stringutils.h"
 
+#include "infrastructure/glyphmetricscache.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -127,6 +129,10 @@ bool EngravingFontsProvider::isFallbackFont(const IEngravingFont* f) const
 void EngravingFontsProvider::clearExternalFonts()
 {
     m_externalSymbolFonts.clear();
+
+    //! NOTE The text fonts that come with the music fonts are about to be registered again,
+    //! possibly from other files, so the measured metrics can't be trusted anymore
+    GlyphMetricsCache::clear();
 }
 
 void EngravingFontsProvider::loadAllFonts()
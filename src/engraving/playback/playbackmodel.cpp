@@ -22,6 +22,8 @@
 
 #include "playbackmodel.h"
 
+#include <limits>
+
 #include "dom/fret.h"
 #include "dom/harmony.h"
 #include "dom/instrument.h"
@@ -32,6 +34,7 @@
 #include "dom/staff.h"
 #include "dom/repeatlist.h"
 #include "dom/segment.h"
+#include "dom/spanner.h"
 #include "dom/tie.h"
 #include "dom/tremolotwochord.h"
 
@@ -701,9 +704,6 @@ bool PlaybackModel::hasToReloadTracks(const ScoreChanges& changes) const
         ElementType::PART,
         ElementType::PLAYTECH_ANNOTATION,
         ElementType::CAPO,
-        ElementType::DYNAMIC,
-        ElementType::HAIRPIN,
-        ElementType::HAIRPIN_SEGMENT,
         ElementType::HARMONY,
         ElementType::STAFF_TEXT,
         ElementType::SOUND_FLAG,
@@ -719,6 +719,10 @@ bool PlaybackModel::hasToReloadTracks(const ScoreChanges& changes) const
         }
     }
 
+    if (hasToReloadTracksFromTick(changes) && !canReloadFromTick()) {
+        return true;
+    }
+
     if (changes.isValidBoundary()) {
         const Measure* measureTo = m_score->tick2measure(Fraction::fromTicks(changes.tickTo));
         if (!measureTo) {
@@ -747,9 +751,6 @@ bool PlaybackModel::hasToReloadScore(const ScoreChanges& changes) const
 {
     static const std::unordered_set<ElementType> REQUIRED_TYPES {
         ElementType::SCORE,
-        ElementType::GRADUAL_TEMPO_CHANGE,
-        ElementType::GRADUAL_TEMPO_CHANGE_SEGMENT,
-        ElementType::TEMPO_TEXT,
         ElementType::LAYOUT_BREAK,
         ElementType::FERMATA,
         ElementType::VOLTA,
@@ -767,6 +768,10 @@ bool PlaybackModel::hasToReloadScore(const ScoreChanges& changes) const
         }
     }
 
+    if (hasToReloadScoreFromTick(changes) && !canReloadFromTick()) {
+        return true;
+    }
+
     static const std::unordered_set<mu::engraving::Pid> REQUIRED_PROPERTIES {
         mu::engraving::Pid::REPEAT_START,
         mu::engraving::Pid::REPEAT_END,
@@ -783,6 +788,96 @@ bool PlaybackModel::hasToReloadScore(const ScoreChanges& changes) const
     return false;
 }
 
+//! NOTE Dynamics only affect the events of their parts from the change point onwards.
+//! Instrument changes are not included: they add and remove instrument tracks, which needs the full reload
+bool PlaybackModel::hasToReloadTracksFromTick(const ScoreChanges& changes) const
+{
+    static const std::unordered_set<ElementType> REQUIRED_TYPES {
+        ElementType::DYNAMIC,
+        ElementType::HAIRPIN,
+        ElementType::HAIRPIN_SEGMENT,
+    };
+
+    for (const ElementType type : changes.changedTypes) {
+        if (muse::contains(REQUIRED_TYPES, type)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//! NOTE Tempo changes shift the timestamps of all events after the change point, the events before it stay untouched
+bool PlaybackModel::hasToReloadScoreFromTick(const ScoreChanges& changes) const
+{
+    static const std::unordered_set<ElementType> REQUIRED_TYPES {
+        ElementType::GRADUAL_TEMPO_CHANGE,
+        ElementType::GRADUAL_TEMPO_CHANGE_SEGMENT,
+        ElementType::TEMPO_TEXT,
+    };
+
+    for (const ElementType type : changes.changedTypes) {
+        if (muse::contains(REQUIRED_TYPES, type)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//! NOTE With repeats, the measures before the change point can be played again after it,
+//! so everything has to be reloaded
+bool PlaybackModel::canReloadFromTick() const
+{
+    return repeatList().size() <= 1;
+}
+
+//! NOTE Returns the tick to reload from, so that no event sounding at the given tick is left out:
+//! the reload starts at a measure boundary and includes notes tied into the measure
+//! as well as spanners (hairpins, pedals, ...) which are already running
+int PlaybackModel::reloadFromTick(const int tick, const track_idx_t trackFrom, const track_idx_t trackTo) const
+{
+    int result = tick;
+
+    while (true) {
+        const Measure* measure = m_score->tick2measure(Fraction::fromTicks(result));
+        if (!measure) {
+            return result;
+        }
+
+        int from = measure->tick().ticks();
+
+        const Segment* segment = measure->first(SegmentType::ChordRest);
+        if (segment && segment->tick() == measure->tick()) {
+            for (track_idx_t track = trackFrom; track < trackTo && track < m_score->ntracks(); ++track) {
+                const EngravingItem* item = segment->element(track);
+                if (!item || !item->isChord()) {
+                    continue;
+                }
+
+                for (const Note* note : toChord(item)->notes()) {
+                    if (note->tieBack()) {
+                        from = std::min(from, note->firstTiedNote()->tick().ticks());
+                    }
+                }
+            }
+        }
+
+        for (const auto& interval : m_score->spannerMap().findOverlapping(from, from)) {
+            const Spanner* spanner = interval.value;
+            if (spanner->track() >= trackFrom && spanner->track() < trackTo) {
+                from = std::min(from, spanner->tick().ticks());
+            }
+        }
+
+        if (from >= result) {
+            return result;
+        }
+
+        result = from;
+    }
+}
+
 void PlaybackModel::clearExpiredTracks()
 {
     auto needRemoveTrack = [this](const InstrumentTrackId& trackId) {
@@ -874,10 +969,17 @@ void PlaybackModel::clearExpiredEvents(const int tickFrom, const int tickTo, con
         return;
     }
 
-    for (const RepeatSegment* repeatSegment : repeatList()) {
+    //! NOTE: when reloading up to the end of the score, the tempo may have changed,
+    //! so the old events after the range can't be located by the new timestamps; remove everything after it
+    const bool toScoreEnd = tickTo >= lastMeasure->endTick().ticks();
+    const RepeatList& repeats = repeatList();
+    static constexpr timestamp_t MAX_TIMESTAMP = std::numeric_limits<timestamp_t>::max();
+
+    for (const RepeatSegment* repeatSegment : repeats) {
         const int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
         const int repeatStartTick = repeatSegment->tick;
         const int repeatEndTick = repeatSegment->endTick();
+        const bool removeToEnd = toScoreEnd && repeatSegment == repeats.back();
 
         if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
             continue;
@@ -889,7 +991,7 @@ void PlaybackModel::clearExpiredEvents(const int tickFrom, const int tickTo, con
         //! NOTE: the end tick of the current repeat segment == the start tick of the next repeat segment
         //! so subtract 1 to avoid removing events belonging to the next segment
         int removeEventsToTick = std::min(tickTo, repeatEndTick - 1);
-        timestamp_t removeEventsTo = timestampFromTicks(m_score, removeEventsToTick + tickPositionOffset);
+        timestamp_t removeEventsTo = removeToEnd ? MAX_TIMESTAMP : timestampFromTicks(m_score, removeEventsToTick + tickPositionOffset);
 
         removeEventsFromRange(trackFrom, trackTo, removeEventsFrom, removeEventsTo, trackChanges);
 
@@ -906,7 +1008,8 @@ void PlaybackModel::clearExpiredEvents(const int tickFrom, const int tickTo, con
             }
 
             removeEventsFrom = timestampFromTicks(m_score, measureStartTick + tickPositionOffset);
-            removeEventsTo = timestampFromTicks(m_score, measureEndTick + tickPositionOffset - 1);
+            removeEventsTo = removeToEnd && measure == repeatSegment->lastMeasure()
+                             ? MAX_TIMESTAMP : timestampFromTicks(m_score, measureEndTick + tickPositionOffset - 1);
 
             removeTrackEvents(METRONOME_TRACK_ID, removeEventsFrom, removeEventsTo, trackChanges);
         }
@@ -1041,9 +1144,22 @@ PlaybackModel::TrackBoundaries PlaybackModel::trackBoundaries(const ScoreChanges
     result.trackFrom = staff2track(changes.staffIdxFrom, 0);
     result.trackTo = staff2track(changes.staffIdxTo, VOICES);
 
-    if (hasToReloadScore(changes) || !changes.isValidBoundary()) {
+    if (hasToReloadScore(changes) || hasToReloadScoreFromTick(changes) || !changes.isValidBoundary()) {
         result.trackFrom = 0;
         result.trackTo = m_score->ntracks();
+        return result;
+    }
+
+    if (hasToReloadTracksFromTick(changes)) {
+        // dynamics may apply to all staves of the part
+        for (const Part* part : m_score->parts()) {
+            if (part->startTrack() >= result.trackTo || part->endTrack() <= result.trackFrom) {
+                continue;
+            }
+
+            result.trackFrom = std::min(result.trackFrom, part->startTrack());
+            result.trackTo = std::max(result.trackTo, part->endTrack());
+        }
     }
 
     return result;
@@ -1066,6 +1182,15 @@ PlaybackModel::TickBoundaries PlaybackModel::tickBoundaries(const ScoreChanges&
         return result;
     }
 
+    if (hasToReloadScoreFromTick(changes) || hasToReloadTracksFromTick(changes)) {
+        const TrackBoundaries trackRange = trackBoundaries(changes);
+        const Measure* lastMeasure = m_score->lastMeasure();
+        result.tickFrom = reloadFromTick(changes.tickFrom, trackRange.trackFrom, trackRange.trackTo);
+        result.tickTo = lastMeasure ? lastMeasure->endTick().ticks() : 0;
+
+        return result;
+    }
+
     for (const auto& pair : changes.changedObjects) {
         if (!pair.first->isEngravingItem()) {
             continue;
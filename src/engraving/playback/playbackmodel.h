@@ -132,6 +132,10 @@ private:
 
     bool hasToReloadTracks(const ScoreChanges& changes) const;
     bool hasToReloadScore(const ScoreChanges& changes) const;
+    bool hasToReloadTracksFromTick(const ScoreChanges& changes) const;
+    bool hasToReloadScoreFromTick(const ScoreChanges& changes) const;
+    bool canReloadFromTick() const;
+    int reloadFromTick(const int tick, const track_idx_t trackFrom, const track_idx_t trackTo) const;
 
     void clearExpiredTracks();
     void clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo);
@@ -0,0 +1,93 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+import QtQuick
+import QtQuick.Controls
+import QtQuick.Layouts
+
+import Muse.Ui
+import Muse.UiComponents
+import MuseScore.Engraving
+
+ColumnLayout {
+    id: root
+    objectName: "DiagnosticEngravingCmdLatencyPanel"
+
+    spacing: 12
+
+    EngravingCmdLatencyModel {
+        id: latencyModel
+    }
+
+    Component.onCompleted: {
+        latencyModel.init()
+    }
+
+    RowLayout {
+        Layout.fillWidth: true
+        spacing: 12
+
+        FlatButton {
+            Layout.fillWidth: true
+            text: "Reset"
+            onClicked: latencyModel.reset()
+        }
+
+        FlatButton {
+            Layout.fillWidth: true
+            text: "Copy JSON"
+            onClicked: latencyModel.copyJsonToClipboard()
+        }
+    }
+
+    StyledTextLabel {
+        Layout.fillWidth: true
+        horizontalAlignment: Text.AlignLeft
+        text: "Average/max per phase, slowest commands first"
+    }
+
+    StyledListView {
+        Layout.fillWidth: true
+        Layout.fillHeight: true
+        spacing: 2
+
+        model: latencyModel
+
+        delegate: Column {
+            anchors.left: parent ? parent.left : undefined
+            anchors.right: parent ? parent.right : undefined
+
+            StyledTextLabel {
+                width: parent.width
+                horizontalAlignment: Text.AlignLeft
+                font: ui.theme.bodyBoldFont
+                text: actionRole + " (" + countRole + ")"
+            }
+
+            StyledTextLabel {
+                width: parent.width
+                horizontalAlignment: Text.AlignLeft
+                wrapMode: Text.WordWrap
+                text: summaryRole
+            }
+        }
+    }
+}
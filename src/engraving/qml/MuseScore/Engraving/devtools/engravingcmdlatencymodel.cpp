@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "engravingcmdlatencymodel.h"
+
+#include <algorithm>
+
+#include <QClipboard>
+#include <QGuiApplication>
+
+
+using namespace mu::engraving;
+
+static constexpr int RELOAD_INTERVAL_MS = 1000;
+
+EngravingCmdLatencyModel::EngravingCmdLatencyModel(QObject* parent)
+    : QAbstractListModel(parent)
+{
+}
+
+void EngravingCmdLatencyModel::init()
+{
+    reload();
+
+    m_reloadTimer.setInterval(RELOAD_INTERVAL_MS);
+    connect(&m_reloadTimer, &QTimer::timeout, this, &EngravingCmdLatencyModel::reload);
+    m_reloadTimer.start();
+}
+
+void EngravingCmdLatencyModel::reload()
+{
+    beginResetModel();
+
+    m_items.clear();
+    for (auto& [actionName, cmd] : CmdLatencyStats::stats()) {
+        m_items.emplace_back(actionName, cmd);
+    }
+
+    // slowest commands first
+    std::sort(m_items.begin(), m_items.end(), [](const auto& a, const auto& b) {
+        return a.second.phase(CmdLatencyPhase::Total).averageMs() > b.second.phase(CmdLatencyPhase::Total).averageMs();
+    });
+
+    endResetModel();
+}
+
+void EngravingCmdLatencyModel::reset()
+{
+    CmdLatencyStats::clear();
+    reload();
+}
+
+void EngravingCmdLatencyModel::copyJsonToClipboard() const
+{
+    const muse::ByteArray json = CmdLatencyStats::toJson();
+    QGuiApplication::clipboard()->setText(QString::fromUtf8(json.constChar(), static_cast<int>(json.size())));
+}
+
+QVariant EngravingCmdLatencyModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= rowCount()) {
+        return QVariant();
+    }
+
+    const auto& [actionName, cmd] = m_items.at(static_cast<size_t>(index.row()));
+    switch (role) {
+    case ActionRole: return actionName.isEmpty() ? QString("<unnamed>") : actionName.toQString();
+    case CountRole: return static_cast<int>(cmd.phase(CmdLatencyPhase::Total).count);
+    case SummaryRole: return phasesSummary(cmd);
+    }
+    return QVariant();
+}
+
+int EngravingCmdLatencyModel::rowCount(const QModelIndex&) const
+{
+    return static_cast<int>(m_items.size());
+}
+
+QHash<int, QByteArray> EngravingCmdLatencyModel::roleNames() const
+{
+    static const QHash<int, QByteArray> roles = {
+        { ActionRole, "actionRole" },
+        { CountRole, "countRole" },
+        { SummaryRole, "summaryRole" }
+    };
+    return roles;
+}
+
+QString EngravingCmdLatencyModel::phasesSummary(const CmdLatencyStats::CommandStats& cmd) const
+{
+    QStringList parts;
+    for (size_t i = 0; i < CmdLatencyStats::PHASE_COUNT; ++i) {
+        const CmdLatencyStats::Histogram& h = cmd.phases[i];
+        parts << QString("%1 %2/%3 ms")
+            .arg(CmdLatencyStats::phaseName(static_cast<CmdLatencyPhase>(i)))
+            .arg(h.averageMs(), 0, 'f', 1)
+            .arg(h.maxMs, 0, 'f', 1);
+    }
+    return parts.join(", ");
+}
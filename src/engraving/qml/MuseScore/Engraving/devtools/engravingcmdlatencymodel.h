@@ -0,0 +1,60 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QAbstractListModel>
+#include <QTimer>
+#include <qqmlintegration.h>
+
+#include "engraving/editing/cmdlatency.h"
+
+namespace mu::engraving {
+class EngravingCmdLatencyModel : public QAbstractListModel
+{
+    Q_OBJECT
+    QML_ELEMENT;
+
+public:
+    explicit EngravingCmdLatencyModel(QObject* parent = nullptr);
+
+    QVariant data(const QModelIndex& index, int role) const override;
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    Q_INVOKABLE void init();
+    Q_INVOKABLE void reload();
+    Q_INVOKABLE void reset();
+    Q_INVOKABLE void copyJsonToClipboard() const;
+
+private:
+    enum Roles {
+        ActionRole = Qt::UserRole + 1,
+        CountRole,
+        SummaryRole
+    };
+
+    QString phasesSummary(const CmdLatencyStats::CommandStats& cmd) const;
+
+    std::vector<std::pair<muse::String, CmdLatencyStats::CommandStats> > m_items;
+    QTimer m_reloadTimer;
+};
+}
@@ -66,7 +66,7 @@ void EngravingUndoStackModel::reload()
     if (INotationPtr notation = context()->currentNotation()) {
         const UndoStack* undoStack = notation->elements()->msScore()->undoStack();
 
-        for (size_t i = 1; i <= undoStack->size(); ++i) {
+        for (size_t i = undoStack->firstIndex() + 1; i <= undoStack->size(); ++i) {
             const UndoableTransaction* transaction = undoStack->lastAtIndex(i);
             Item* item = createItem(m_rootItem, transaction, transaction == undoStack->last());
             load(transaction, item);
@@ -113,6 +113,10 @@ public:
         bool isMultiPage = false;
         bool printPageBackground = true;
         RectF frameRect;
+        //! NOTE Part of the page image to paint, in device pixels (relative to the top left of the trimmed page).
+        //! It's mapped to page coordinates with the viewport to window transform of the painting,
+        //! and the origin is moved to its top left corner, so a device of the tile size receives just this part.
+        RectF tileRect;
         int fromPage = -1; // 0 is first
         int toPage = -1;
         int copyCount = 1;
@@ -121,6 +125,18 @@ public:
 
         std::function<void(muse::draw::Painter* painter, const Page* page, const RectF& pageRect)> onPaintPageSheet;
         std::function<void()> onNewPage;
+
+        //! NOTE The tile rect in page coordinates, for a painting mapping the viewport to the window
+        RectF tileRectInWindow(const RectF& viewport, const RectF& window) const
+        {
+            if (!tileRect.isValid() || viewport.isEmpty()) {
+                return tileRect;
+            }
+
+            const double sx = window.width() / viewport.width();
+            const double sy = window.height() / viewport.height();
+            return RectF(tileRect.x() * sx, tileRect.y() * sy, tileRect.width() * sx, tileRect.height() * sy);
+        }
     };
 
     virtual SizeF pageSizeInch(const Score* score) const = 0;
@@ -22,6 +22,10 @@
 #ifndef MU_ENGRAVING_LAYOUTOPTIONS_H
 #define MU_ENGRAVING_LAYOUTOPTIONS_H
 
+#include <cstddef>
+
+#include "../types/fraction.h"
+
 namespace mu::engraving {
 //---------------------------------------------------------
 //   LayoutMode
@@ -42,8 +46,15 @@ struct LayoutOptions
     bool isShowVBox = true;
     double noteHeadWidth = 0.0;
 
+    //! NOTE Lets a one-off export (of the first pages or of a region) lay out only the beginning of the score:
+    //! the page view layout stops once pageLimit pages are final and the page with endTickLimit is final.
+    //! The pages after them are not created
+    size_t pageLimit = 0;
+    Fraction endTickLimit = Fraction::max();
+
     bool isMode(LayoutMode m) const { return mode == m; }
     bool isLinearMode() const { return mode == LayoutMode::LINE || mode == LayoutMode::HORIZONTAL_FIXED; }
+    bool hasLayoutLimit() const { return pageLimit > 0 || endTickLimit != Fraction::max(); }
 };
 }
 
@@ -105,6 +105,9 @@ public:
 
     bool isShowVBox() const { return options().isShowVBox; }
     double noteHeadWidth() const { return options().noteHeadWidth; }
+    bool hasLayoutLimit() const { return options().hasLayoutLimit(); }
+    size_t pageLimit() const { return options().pageLimit; }
+    Fraction endTickLimit() const { return options().endTickLimit; }
     bool isShowInvisible() const;
     int pageNumberOffset() const;
     bool isVerticalSpreadEnabled() const;
@@ -61,14 +61,19 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Sco
 
     //! NOTE To draw on the screen, no need to adjust the viewport,
     //! to draw on others (pdf, png, printer), we need to set the viewport
+    RectF tileRect = opt.tileRect;
     if (opt.isSetViewport) {
-        painter->setViewport(RectF(0.0, 0.0, std::lrint(pageSize.width() * DEVICE_DPI), std::lrint(pageSize.height() * DEVICE_DPI)));
-        painter->setWindow(RectF(0.0, 0.0, std::lrint(pageSize.width() * engraving::DPI), std::lrint(pageSize.height() * engraving::DPI)));
+        const RectF viewport(0.0, 0.0, std::lrint(pageSize.width() * DEVICE_DPI), std::lrint(pageSize.height() * DEVICE_DPI));
+        const RectF window(0.0, 0.0, std::lrint(pageSize.width() * engraving::DPI), std::lrint(pageSize.height() * engraving::DPI));
+        painter->setViewport(viewport);
+        painter->setWindow(window);
+        tileRect = opt.tileRectInWindow(viewport, window);
     }
 
     // Setup score draw system
-    mu::engraving::MScore::pdfPrinting = opt.isPrinting;
-
+    //! NOTE This is the only score state painting changes (restored at the end).
+    //! Painting must not run concurrently with other painting of the same score;
+    //! replaying recorded pages (see INotationPainting::recordPageDisplayLists) doesn't call this
     const bool wasPrinting = score->printing();
     score->setPrinting(opt.isPrinting);
 
@@ -107,6 +112,10 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Sco
                 drawRect = pageAbsRect;
             }
 
+            if (tileRect.isValid()) {
+                drawRect = drawRect.intersected(tileRect.translated(pageAbsRect.topLeft()));
+            }
+
             //! NOTE Notify about new page (usually for paged paint device, ex pdf, printer)
             if (!firstPage) {
                 if (opt.onNewPage) {
@@ -129,6 +138,10 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Sco
                 painter->translate(-pageRect.topLeft());
             }
 
+            if (tileRect.isValid()) {
+                painter->translate(-tileRect.topLeft());
+            }
+
             // Draw page sheet
             if (opt.onPaintPageSheet) {
                 opt.onPaintPageSheet(painter, page, pageRect);
@@ -158,6 +171,10 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Sco
 
             painter->endObject(); // page
 
+            if (tileRect.isValid()) {
+                painter->translate(tileRect.topLeft());
+            }
+
             if (opt.isMultiPage) {
                 painter->translate(-pagePos);
             } else if (opt.trimMarginPixelSize >= 0) {
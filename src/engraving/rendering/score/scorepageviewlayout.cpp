@@ -196,6 +196,28 @@ void ScorePageViewLayout::layoutPageView(Score* score, LayoutContext& ctx, const
     LAYOUT_CALL_PRINT();
 }
 
+//! NOTE Pages are collected one after another, so the collected pages are final,
+//! unless their headers or footers show the number of pages
+static bool isLayoutLimitReached(const LayoutContext& ctx, const MeasureBase* lastPageMeasure)
+{
+    const LayoutConfiguration& conf = ctx.conf();
+    const LayoutState& state = ctx.state();
+
+    if (!conf.hasLayoutLimit() || !state.isLayoutAll() || state.mustRecomputeHeadersFooters()) {
+        return false;
+    }
+
+    if (state.pageIdx() < conf.pageLimit()) {
+        return false;
+    }
+
+    if (conf.endTickLimit() == Fraction::max()) {
+        return true;
+    }
+
+    return lastPageMeasure && lastPageMeasure->endTick() >= conf.endTickLimit();
+}
+
 void ScorePageViewLayout::doLayout(LayoutContext& ctx)
 {
     LAYOUT_CALL();
@@ -215,6 +237,10 @@ void ScorePageViewLayout::doLayout(LayoutContext& ctx)
             lmb = nullptr;
         }
 
+        if (isLayoutLimitReached(ctx, lmb)) {
+            break;
+        }
+
         // we can stop collecting pages when:
         // 1) we reach the end of score (curSystem is nullptr)
         // or
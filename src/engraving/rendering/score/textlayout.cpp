@@ -25,6 +25,7 @@
 #include "dom/page.h"
 #include "dom/staff.h"
 #include "dom/textlinebase.h"
+#include "infrastructure/glyphmetricscache.h"
 #include "types/typesconv.h"
 
 using namespace mu::engraving::rendering::score;
@@ -158,21 +159,20 @@ void TextLayout::computeTextHighResShape(const TextBase* item, TextBase::LayoutD
     for (const TextBlock& block : ldata->blocks) {
         double y = block.y();
         for (const TextFragment& fragment : block.fragments()) {
-            FontMetrics fontMetrics = FontMetrics(fragment.font(item));
+            const Font font = fragment.font(item);
             double x = fragment.pos.x();
             size_t textSize = fragment.text.size();
             for (size_t i = 0; i < textSize; ++i) {
                 Char character = fragment.text.at(i);
-                String text{ character };
+                char32_t code = character.unicode();
                 if (character.isHighSurrogate() && i + 1 < textSize) {
-                    text += fragment.text.at(i + 1);
+                    code = Char::surrogateToUcs4(character, fragment.text.at(i + 1));
                     i++;
                 }
-                RectF characterBoundingRect = fontMetrics.tightBoundingRect(text);
-                characterBoundingRect.translate(x, y);
-                shape.add(characterBoundingRect);
+                const GlyphMetricsCache::GlyphMetrics metrics = GlyphMetricsCache::glyphMetrics(font, code);
+                shape.add(metrics.tightBoundingRect.translated(x, y));
                 if (i + 1 < textSize) {
-                    x += fontMetrics.horizontalAdvance(text);
+                    x += metrics.advance;
                 }
             }
         }
@@ -33,6 +33,8 @@
 #include "dom/imageStore.h"
 #include "dom/audio.h"
 
+#include "editing/transaction/undostack.h"
+
 #include "engraving/automation/iautomation.h"
 
 #include "rwregister.h"
@@ -46,8 +48,7 @@ using namespace muse::io;
 using namespace mu::engraving;
 using namespace mu::engraving::rw;
 
-bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createThumbnail,
-                         const write::WriteContext* ctx)
+bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createThumbnail, const write::WriteContext* ctx)
 {
     TRACEFUNC;
 
@@ -55,6 +56,15 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createTh
         return false;
     }
 
+    //! NOTE The written parts and thumbnail are kept with the change revisions they include,
+    //! and taken as they are if nothing has changed since. The revisions count the undoable changes
+    //! and the saved flags set outside of the undo stack; a change that can't be attributed to a score
+    //! invalidates all of them, other changes outside of the undo stack clear the caches
+    //! (see MasterScore::invalidateWriteCaches). A write with a context may filter the content,
+    //! so it neither uses nor updates the cache
+    const bool useWriteCache = !ctx;
+    const size_t unattributedRevision = score->undoStack()->unattributedChangesRevision();
+
     // Write style of MasterScore
     {
         //! NOTE The style is writing to a separate file only for the master score.
@@ -113,6 +123,42 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createTh
                 return data;
             };
 
+            auto scoreRevision = [](const Excerpt* excerpt) {
+                return excerpt->excerptScore() ? excerpt->excerptScore()->changesRevision() : muse::nidx;
+            };
+
+            auto isUnchanged = [useWriteCache, unattributedRevision, scoreRevision](const Excerpt* excerpt) {
+                const Excerpt::WriteCache& cache = excerpt->writeCache();
+                return useWriteCache
+                       && excerpt->excerptScore()
+                       && cache.scoreRevision == scoreRevision(excerpt)
+                       && cache.unattributedRevision == unattributedRevision;
+            };
+
+            auto updateCache = [useWriteCache, unattributedRevision, scoreRevision](Excerpt* excerpt, const ExcerptData& data) {
+                if (!useWriteCache) {
+                    return;
+                }
+
+                Excerpt::WriteCache cache;
+                cache.scoreRevision = scoreRevision(excerpt);
+                cache.unattributedRevision = unattributedRevision;
+                cache.styleData = data.styleData;
+                cache.scoreData = data.scoreData;
+                excerpt->setWriteCache(cache);
+            };
+
+            auto cachedExcerpt = [](Excerpt* excerpt, size_t excerptIndex) -> ExcerptData {
+                excerpt->updateFileName(excerptIndex);
+
+                ExcerptData data;
+                data.fileName = excerpt->fileName();
+                data.styleData = excerpt->writeCache().styleData;
+                data.scoreData = excerpt->writeCache().scoreData;
+
+                return data;
+            };
+
 #ifdef MUSE_THREADS_SUPPORT
             // Parallelize excerpt serialization (CPU-bound, independent per excerpt)
             std::vector<std::future<ExcerptData> > futures;
@@ -121,6 +167,13 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createTh
             for (size_t excerptIndex = 0; excerptIndex < excerpts.size(); ++excerptIndex) {
                 Excerpt* excerpt = excerpts.at(excerptIndex);
 
+                if (isUnchanged(excerpt)) {
+                    std::promise<ExcerptData> cached;
+                    cached.set_value(cachedExcerpt(excerpt, excerptIndex));
+                    futures.push_back(cached.get_future());
+                    continue;
+                }
+
                 futures.push_back(std::async(std::launch::async, [serializeExcerpt, excerpt, excerptIndex]() {
                     return serializeExcerpt(excerpt, excerptIndex);
                 }));
@@ -128,18 +181,22 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createTh
 
             // Wait for all serializations to complete, then write to mscWriter sequentially
             // (MscWriter is not thread-safe)
-            for (auto& future : futures) {
-                ExcerptData data = future.get();
+            for (size_t excerptIndex = 0; excerptIndex < excerpts.size(); ++excerptIndex) {
+                Excerpt* excerpt = excerpts.at(excerptIndex);
+
+                ExcerptData data = futures.at(excerptIndex).get();
                 mscWriter.addExcerptStyleFile(data.fileName, data.styleData);
                 mscWriter.addExcerptFile(data.fileName, data.scoreData);
+                updateCache(excerpt, data);
             }
 #else
             for (size_t excerptIndex = 0; excerptIndex < excerpts.size(); ++excerptIndex) {
                 Excerpt* excerpt = excerpts.at(excerptIndex);
 
-                ExcerptData data = serializeExcerpt(excerpt, excerptIndex);
+                ExcerptData data = isUnchanged(excerpt) ? cachedExcerpt(excerpt, excerptIndex) : serializeExcerpt(excerpt, excerptIndex);
                 mscWriter.addExcerptStyleFile(data.fileName, data.styleData);
                 mscWriter.addExcerptFile(data.fileName, data.scoreData);
+                updateCache(excerpt, data);
             }
 #endif
         }
@@ -170,12 +227,31 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createTh
     // Write thumbnail
     {
         if (createThumbnail && !score->pages().empty()) {
-            auto pixmap = score->createThumbnail();
-
-            ByteArray ba;
-            auto b = Buffer::opened(IODevice::WriteOnly, &ba);
-            imageProvider()->saveAsPng(pixmap, &b);
-            mscWriter.writeThumbnailFile(ba);
+            const MasterScore::ThumbnailCache& cache = score->thumbnailCache();
+            const Color backgroundColor = score->configuration()->thumbnailBackgroundColor();
+
+            if (useWriteCache
+                && cache.scoreRevision == score->changesRevision()
+                && cache.unattributedRevision == unattributedRevision
+                && cache.backgroundColor == backgroundColor) {
+                mscWriter.writeThumbnailFile(cache.pngData);
+            } else {
+                auto pixmap = score->createThumbnail();
+
+                ByteArray ba;
+                auto b = Buffer::opened(IODevice::WriteOnly, &ba);
+                imageProvider()->saveAsPng(pixmap, &b);
+                mscWriter.writeThumbnailFile(ba);
+
+                if (useWriteCache) {
+                    MasterScore::ThumbnailCache newCache;
+                    newCache.scoreRevision = score->changesRevision();
+                    newCache.unattributedRevision = unattributedRevision;
+                    newCache.backgroundColor = backgroundColor;
+                    newCache.pngData = ba;
+                    score->setThumbnailCache(newCache);
+                }
+            }
         }
     }
 
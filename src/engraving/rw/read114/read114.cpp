@@ -2948,7 +2948,9 @@ muse::Ret Read114::readScoreFile(Score* score, XmlReader& e, ReadInOutData* out)
         size_t idx = s->idx();
         track_idx_t track = idx * VOICES;
 
-        for (auto i : s->clefList()) {
+        // iterate over a copy, because adding a Clef modifies the staff's clef list (see Staff::setClef)
+        const ClefList clefs = s->clefList();
+        for (const auto& i : clefs) {
             Fraction tick   = Fraction::fromTicks(i.first);
             ClefType clefId = i.second.concertClef;
             Measure* m      = masterScore->tick2measure(tick);
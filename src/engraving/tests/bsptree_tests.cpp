@@ -84,3 +84,42 @@ TEST_F(Engraving_BspTreeTests, NearestNeighbor)
         EXPECT_EQ(nn, singleNote);
     }
 }
+
+/**
+ * @brief Engraving_BspTreeTests_ItemsIntoBuffer
+ * @details Check that querying into a reused buffer returns the same items as the allocating overloads
+ */
+TEST_F(Engraving_BspTreeTests, ItemsIntoBuffer)
+{
+    Score* score = ScoreRW::readScore(BSPTREE_DATA_DIR + u"nearest_neighbor.mscx");
+    EXPECT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    EXPECT_TRUE(page);
+
+    std::vector<EngravingItem*> buffer;
+
+    // [GIVEN] The position and a small hit rect around every element on the page
+    for (EngravingItem* elem : page->elements()) {
+        PointF pos = elem->pageBoundingRect().center();
+        RectF rect(pos.x() - 2.0, pos.y() - 2.0, 6.0, 6.0);
+
+        // [WHEN] Querying the page both ways
+        std::vector<EngravingItem*> expectedRect = page->items(rect);
+        page->items(rect, buffer);
+
+        // [THEN] The same items are returned
+        EXPECT_EQ(buffer, expectedRect);
+
+        std::vector<EngravingItem*> expectedPoint = page->items(pos);
+        page->items(pos, buffer);
+        EXPECT_EQ(buffer, expectedPoint);
+    }
+
+    // [THEN] No item is left marked as discovered
+    for (EngravingItem* elem : page->elements()) {
+        EXPECT_FALSE(elem->itemDiscovered);
+    }
+
+    delete score;
+}
@@ -455,3 +455,44 @@ TEST_F(Engraving_ChordSymbolTests, testAddHarmonyToFretDiagram)
 
     delete score;
 }
+
+TEST_F(Engraving_ChordSymbolTests, testChordListIndexedLookup)
+{
+    MasterScore* score = test_pre(u"extend");
+    const ChordList* cl = score->chordList();
+    ASSERT_FALSE(cl->empty());
+
+    // Reference: linear scan, exact name first, else last parsed match
+    auto scan = [cl](const String& name, const ParsedChord* pc) -> const ChordDescription* {
+        const ChordDescription* match = nullptr;
+        for (const auto& p : *cl) {
+            for (const String& s : p.second.names) {
+                if (s == name) {
+                    return &p.second;
+                }
+                if (!pc) {
+                    continue;
+                }
+                for (const ParsedChord& sParsed : p.second.parsedChords) {
+                    if (sParsed == *pc) {
+                        match = &p.second;
+                    }
+                }
+            }
+        }
+        return match;
+    };
+
+    for (const auto& p : *cl) {
+        for (const String& name : p.second.names) {
+            EXPECT_EQ(cl->description(name), scan(name, nullptr));
+
+            ParsedChord parsed;
+            parsed.parse(name, cl);
+            EXPECT_EQ(cl->parsedChord(name).handle(), parsed.handle());
+            EXPECT_EQ(cl->description(u"?" + name, &parsed), scan(u"?" + name, &parsed));
+        }
+    }
+
+    delete score;
+}
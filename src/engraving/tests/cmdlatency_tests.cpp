@@ -0,0 +1,112 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "engraving/editing/cmdlatency.h"
+
+using namespace mu::engraving;
+
+class Engraving_CmdLatencyTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        CmdLatencyStats::clear();
+    }
+
+    void TearDown() override
+    {
+        CmdLatencyStats::clear();
+    }
+};
+
+TEST_F(Engraving_CmdLatencyTests, BucketIndex)
+{
+    //! [THEN] Buckets are powers of two in milliseconds, the lower bound is inclusive
+    EXPECT_EQ(CmdLatencyStats::bucketIndex(0.0), 0);
+    EXPECT_EQ(CmdLatencyStats::bucketIndex(0.999), 0);
+    EXPECT_EQ(CmdLatencyStats::bucketIndex(1.0), 1);
+    EXPECT_EQ(CmdLatencyStats::bucketIndex(1.5), 1);
+    EXPECT_EQ(CmdLatencyStats::bucketIndex(2.0), 2);
+    EXPECT_EQ(CmdLatencyStats::bucketIndex(3.999), 2);
+    EXPECT_EQ(CmdLatencyStats::bucketIndex(4.0), 3);
+    EXPECT_EQ(CmdLatencyStats::bucketIndex(1023.0), 10);
+
+    //! [THEN] Everything from 1024 ms goes to the last bucket
+    EXPECT_EQ(CmdLatencyStats::bucketIndex(1024.0), CmdLatencyStats::BUCKET_COUNT - 1);
+    EXPECT_EQ(CmdLatencyStats::bucketIndex(1e9), CmdLatencyStats::BUCKET_COUNT - 1);
+}
+
+TEST_F(Engraving_CmdLatencyTests, BucketUpperBound)
+{
+    //! [THEN] Every value falls below the upper bound of its bucket and not below the one before
+    for (double ms : { 0.0, 0.5, 1.0, 3.0, 17.0, 511.0, 512.0, 1023.5, 5000.0 }) {
+        const size_t bucket = CmdLatencyStats::bucketIndex(ms);
+        EXPECT_LT(ms, CmdLatencyStats::bucketUpperBoundMs(bucket));
+        if (bucket > 0) {
+            EXPECT_GE(ms, CmdLatencyStats::bucketUpperBoundMs(bucket - 1));
+        }
+    }
+
+    EXPECT_TRUE(std::isinf(CmdLatencyStats::bucketUpperBoundMs(CmdLatencyStats::BUCKET_COUNT - 1)));
+}
+
+TEST_F(Engraving_CmdLatencyTests, Histogram)
+{
+    CmdLatencyStats::Histogram h;
+    h.add(0.5);
+    h.add(1.5);
+    h.add(1.7);
+    h.add(2000.0);
+
+    EXPECT_EQ(h.count, 4);
+    EXPECT_EQ(h.buckets[0], 1);
+    EXPECT_EQ(h.buckets[1], 2);
+    EXPECT_EQ(h.buckets[CmdLatencyStats::BUCKET_COUNT - 1], 1);
+    EXPECT_DOUBLE_EQ(h.maxMs, 2000.0);
+    EXPECT_DOUBLE_EQ(h.averageMs(), (0.5 + 1.5 + 1.7 + 2000.0) / 4);
+}
+
+TEST_F(Engraving_CmdLatencyTests, SamplesAreGroupedByAction)
+{
+    CmdLatencyStats::PhaseTimes times = {};
+    times[static_cast<size_t>(CmdLatencyPhase::Layout)] = 3.0;
+    times[static_cast<size_t>(CmdLatencyPhase::Total)] = 5.0;
+
+    CmdLatencyStats::addSample(u"Add note", times);
+    CmdLatencyStats::addSample(u"Add note", times);
+    CmdLatencyStats::addSample(u"Delete", times);
+
+    const auto stats = CmdLatencyStats::stats();
+    ASSERT_EQ(stats.size(), 2);
+
+    const CmdLatencyStats::CommandStats& addNote = stats.at(u"Add note");
+    EXPECT_EQ(addNote.phase(CmdLatencyPhase::Total).count, 2);
+    EXPECT_EQ(addNote.phase(CmdLatencyPhase::Layout).buckets[CmdLatencyStats::bucketIndex(3.0)], 2);
+    EXPECT_EQ(addNote.phase(CmdLatencyPhase::Edit).buckets[0], 2);
+
+    CmdLatencyStats::clear();
+    EXPECT_TRUE(CmdLatencyStats::stats().empty());
+}
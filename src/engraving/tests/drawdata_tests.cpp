@@ -22,6 +22,7 @@
 #include <gtest/gtest.h>
 
 #include <cstring>
+#include <string>
 
 #include "draw/types/drawdata.h"
 #include "draw/painter.h"
@@ -33,6 +34,8 @@
 
 #include "engraving/devtools/drawdata/drawdataconverter.h"
 #include "engraving/devtools/drawdata/drawdatagenerator.h"
+#include "engraving/devtools/drawdata/drawdatacomparator.h"
+#include "engraving/devtools/drawdata/drawdatahash.h"
 
 #include "log.h"
 
@@ -306,3 +309,106 @@ TEST_F(Engraving_DrawDataTests, ScoreDrawDiff)
 
     saveDiff("4_diff.png", data1, diff.dataAdded);
 }
+
+static DrawDataPtr drawTwoPages(double secondPageLineY)
+{
+    std::shared_ptr<BufferedPaintProvider> prv = std::make_shared<BufferedPaintProvider>();
+    Painter p(prv, "test");
+
+    RectF viewport(0, 0, 300, 300);
+    p.setViewport(viewport);
+    p.setWindow(viewport);
+    p.setPen(Color::GREEN);
+
+    p.beginObject("page_0");
+    p.drawLine(0, 0, 120, 0);
+    p.endObject();
+
+    p.beginObject("page_1");
+    p.drawLine(0, secondPageLineY, 120, secondPageLineY);
+    p.endObject();
+
+    p.endDraw();
+
+    return prv->drawData();
+}
+
+TEST_F(Engraving_DrawDataTests, ComparatorSkipsSamePages)
+{
+    // [GIVEN] Two draw datas, that differ only on the second page
+    DrawDataPtr origin = drawTwoPages(20);
+    DrawDataPtr same = drawTwoPages(20);
+    DrawDataPtr test = drawTwoPages(22);
+
+    // [WHEN] Hash the pages
+    DrawDataHash::Index originIndex = DrawDataHash::index(origin);
+    DrawDataHash::Index sameIndex = DrawDataHash::index(same);
+    DrawDataHash::Index testIndex = DrawDataHash::index(test);
+
+    // [THEN] The same content has the same hashes, only the changed page has another hash
+    ASSERT_EQ(originIndex.pageHashes.size(), 2);
+    EXPECT_TRUE(originIndex.isComplete());
+    EXPECT_TRUE(originIndex == sameIndex);
+    EXPECT_EQ(originIndex.rootHash, testIndex.rootHash);
+    EXPECT_EQ(originIndex.pageHashes.at(0), testIndex.pageHashes.at(0));
+    EXPECT_NE(originIndex.pageHashes.at(1), testIndex.pageHashes.at(1));
+
+    // [THEN] The comparator finds the change on the second page, and no change for the same content
+    DrawDataComparator c;
+    EXPECT_TRUE(c.compare(origin, same).empty());
+
+    Diff diff = c.compare(origin, test);
+    EXPECT_FALSE(diff.empty());
+}
+
+TEST_F(Engraving_DrawDataTests, ComparatorIndex)
+{
+    // [GIVEN] Generated data with the index
+    DrawDataPtr origin = drawTwoPages(20);
+    DrawDataRW::writeData("5_ref.json", origin);
+    DrawDataRW::writeData("5_test.json", origin);
+    ASSERT_TRUE(DrawDataHash::writeIndex("5_ref.json", origin));
+    ASSERT_TRUE(DrawDataHash::writeIndex("5_test.json", origin));
+
+    // [WHEN] Read the index
+    RetVal<DrawDataHash::Index> index = DrawDataHash::readIndex("5_ref.json");
+
+    // [THEN] It has the hashes of the data
+    ASSERT_TRUE(index.ret);
+    EXPECT_TRUE(index.val == DrawDataHash::index(origin));
+
+    DrawDataComparator c;
+    EXPECT_TRUE(c.compare("5_ref.json", "5_test.json", "5_diff.json"));
+
+    // [WHEN] The data file is rewritten with other content of the same size
+    ByteArray data;
+    ASSERT_TRUE(io::File::readFile("5_test.json", data));
+    const std::string sameSize(data.size(), ' ');
+    io::File::writeFile("5_test.json", ByteArray(sameSize.c_str()));
+
+    // [THEN] The index doesn't describe it anymore
+    EXPECT_FALSE(DrawDataHash::readIndex("5_test.json").ret);
+
+    // [WHEN] The data file is replaced
+    io::File::writeFile("5_test.json", ByteArray("broken"));
+
+    // [THEN] The index doesn't describe it anymore, the data is parsed and the error is reported
+    EXPECT_FALSE(DrawDataHash::readIndex("5_test.json").ret);
+    EXPECT_FALSE(c.compare("5_ref.json", "5_test.json", "5_diff.json"));
+}
+
+TEST_F(Engraving_DrawDataTests, ComparatorRejectsSameBrokenFiles)
+{
+    // [GIVEN] Two identical broken files, without the index
+    io::File::writeFile("6_ref.json", ByteArray("broken"));
+    io::File::writeFile("6_test.json", ByteArray("broken"));
+    io::File::remove(DrawDataHash::indexPath("6_ref.json"));
+    io::File::remove(DrawDataHash::indexPath("6_test.json"));
+
+    // [WHEN] Compare them
+    DrawDataComparator c;
+    Ret ret = c.compare("6_ref.json", "6_test.json", "6_diff.json");
+
+    // [THEN] The error is reported
+    EXPECT_FALSE(ret);
+}
@@ -0,0 +1,117 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "engraving/infrastructure/flatmap.h"
+
+using namespace mu::engraving;
+
+class Engraving_FlatMapTests : public ::testing::Test
+{
+};
+
+/**
+ * @brief FlatMapTests_SameAsStdMap
+ * @details Applies the same random inserts and removals to a FlatMap and a std::map
+ *          and checks that lookups return the same elements
+ */
+TEST_F(Engraving_FlatMapTests, SameAsStdMap)
+{
+    std::mt19937 random(42);
+
+    for (int round = 0; round < 200; ++round) {
+        FlatMap<int, int> flatMap;
+        std::map<int, int> stdMap;
+
+        const int operations = random() % 64;
+        for (int i = 0; i < operations; ++i) {
+            const int key = random() % 100;
+            const int value = random();
+
+            switch (random() % 4) {
+            case 0:
+                flatMap[key] = value;
+                stdMap[key] = value;
+                break;
+            case 1:
+                EXPECT_EQ(flatMap.insert(std::pair<const int, int>(key, value)).second, stdMap.insert({ key, value }).second);
+                break;
+            case 2:
+                EXPECT_EQ(flatMap.erase(key), stdMap.erase(key));
+                break;
+            case 3:
+                flatMap.erase(flatMap.lower_bound(key), flatMap.lower_bound(key + 10));
+                stdMap.erase(stdMap.lower_bound(key), stdMap.lower_bound(key + 10));
+                break;
+            }
+        }
+
+        ASSERT_EQ(flatMap.size(), stdMap.size());
+        EXPECT_TRUE(std::equal(flatMap.begin(), flatMap.end(), stdMap.begin(), [](const auto& a, const auto& b) {
+            return a.first == b.first && a.second == b.second;
+        }));
+
+        for (int key = -1; key <= 101; ++key) {
+            auto flatLower = flatMap.lower_bound(key);
+            auto stdLower = stdMap.lower_bound(key);
+            ASSERT_EQ(flatLower == flatMap.end(), stdLower == stdMap.end());
+            if (stdLower != stdMap.end()) {
+                EXPECT_EQ(flatLower->first, stdLower->first);
+            }
+
+            auto flatUpper = flatMap.upper_bound(key);
+            auto stdUpper = stdMap.upper_bound(key);
+            ASSERT_EQ(flatUpper == flatMap.end(), stdUpper == stdMap.end());
+            if (stdUpper != stdMap.end()) {
+                EXPECT_EQ(flatUpper->first, stdUpper->first);
+            }
+
+            EXPECT_EQ(flatMap.count(key), stdMap.count(key));
+        }
+    }
+}
+
+/**
+ * @brief FlatMapTests_EraseWhileIterating
+ * @details Erasing with the returned iterator keeps the iteration valid
+ */
+TEST_F(Engraving_FlatMapTests, EraseWhileIterating)
+{
+    FlatMap<int, int> map { { 0, 0 }, { 480, 1 }, { 960, 2 }, { 1440, 3 } };
+
+    for (auto it = map.lower_bound(480); it != map.end();) {
+        if (it->second % 2) {
+            it = map.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    ASSERT_EQ(map.size(), 2);
+    EXPECT_EQ(map.begin()->first, 0);
+    EXPECT_EQ(map.rbegin()->first, 960);
+}
@@ -0,0 +1,95 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "draw/fontmetrics.h"
+
+#include "engraving/infrastructure/glyphmetricscache.h"
+#include "engraving/internal/engravingfontsprovider.h"
+
+using namespace mu::engraving;
+using namespace muse;
+using namespace muse::draw;
+
+class Engraving_GlyphMetricsCacheTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        GlyphMetricsCache::clear();
+    }
+
+    static Font textFont(double pointSize)
+    {
+        Font font(u"Edwin", Font::Type::Text);
+        font.setPointSizeF(pointSize);
+        return font;
+    }
+};
+
+TEST_F(Engraving_GlyphMetricsCacheTests, MatchesFontMetrics)
+{
+    const Font font = textFont(10.0);
+    const FontMetrics fm(font);
+
+    for (char32_t code : { U'a', U'W', U'1', U' ' }) {
+        const String text = String::fromUcs4(code);
+
+        //! [WHEN] The metrics are asked twice: measured, then cached
+        for (int i = 0; i < 2; ++i) {
+            //! [THEN] They are the same as measured by FontMetrics
+            EXPECT_DOUBLE_EQ(GlyphMetricsCache::horizontalAdvance(font, code), fm.horizontalAdvance(text));
+            EXPECT_EQ(GlyphMetricsCache::tightBoundingRect(font, code), fm.tightBoundingRect(text));
+        }
+    }
+
+    EXPECT_DOUBLE_EQ(GlyphMetricsCache::ascent(font), FontMetrics::ascent(font));
+    EXPECT_DOUBLE_EQ(GlyphMetricsCache::capHeight(font), FontMetrics::capHeight(font));
+}
+
+TEST_F(Engraving_GlyphMetricsCacheTests, FontsAreCachedSeparately)
+{
+    const Font small = textFont(10.0);
+    const Font large = textFont(20.0);
+
+    GlyphMetricsCache::horizontalAdvance(small, U'a');
+    GlyphMetricsCache::horizontalAdvance(large, U'a');
+    EXPECT_EQ(GlyphMetricsCache::fontsCount(), 2);
+
+    //! [THEN] Line metrics of a font that only has glyphs cached are measured, not left empty
+    EXPECT_DOUBLE_EQ(GlyphMetricsCache::ascent(large), FontMetrics::ascent(large));
+    EXPECT_EQ(GlyphMetricsCache::fontsCount(), 2);
+}
+
+TEST_F(Engraving_GlyphMetricsCacheTests, ClearedWhenExternalFontsChange)
+{
+    GlyphMetricsCache::horizontalAdvance(textFont(10.0), U'a');
+    EXPECT_EQ(GlyphMetricsCache::fontsCount(), 1);
+
+    //! [WHEN] The external music fonts are scanned again
+    EngravingFontsProvider provider;
+    provider.clearExternalFonts();
+
+    //! [THEN] The cache is dropped
+    EXPECT_EQ(GlyphMetricsCache::fontsCount(), 0);
+}
@@ -162,3 +162,42 @@ TEST_F(Engraving_LayoutElementsTests, tstLayoutCrossStaffArp)
 
     delete score;
 }
+
+TEST_F(Engraving_LayoutElementsTests, tstLayoutLimit)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_GT(score->npages(), 2u);
+
+    auto systemsLayout = [](const Page* page) {
+        std::vector<std::pair<Fraction, PointF> > systems;
+        for (const System* system : page->systems()) {
+            systems.emplace_back(system->first()->tick(), system->pagePos());
+        }
+        return systems;
+    };
+
+    // [GIVEN] The full layout of the first two pages
+    const auto page0 = systemsLayout(score->pages().at(0));
+    const auto page1 = systemsLayout(score->pages().at(1));
+    const MeasureBase* lastMeasureOnPage1 = score->pages().at(1)->systems().back()->last();
+
+    // [WHEN] Only the first two pages are laid out
+    score->setLayoutLimit(2);
+    score->doLayout();
+
+    // [THEN] The layout stops after them, and they are the same as in the full layout
+    EXPECT_EQ(score->npages(), 2u);
+    EXPECT_EQ(systemsLayout(score->pages().at(0)), page0);
+    EXPECT_EQ(systemsLayout(score->pages().at(1)), page1);
+
+    // [WHEN] The layout is limited to the last measure of the second page
+    score->setLayoutLimit(0, lastMeasureOnPage1->endTick());
+    score->doLayout();
+
+    // [THEN] The same pages are laid out
+    EXPECT_EQ(score->npages(), 2u);
+    EXPECT_EQ(systemsLayout(score->pages().at(1)), page1);
+
+    delete score;
+}
@@ -95,6 +95,9 @@ public:
 
     MOCK_METHOD(bool, allowReadingImagesFromOutsideMscz, (), (const, override));
 
+    MOCK_METHOD(size_t, undoHistoryCommandsLimit, (), (const, override));
+    MOCK_METHOD(void, setUndoHistoryCommandsLimit, (size_t), (override));
+
     MOCK_METHOD(bool, guitarProImportExperimental, (), (const, override));
     MOCK_METHOD(bool, negativeFretsAllowed, (), (const, override));
     MOCK_METHOD(void, setGuitarProMultivoiceEnabled, (bool), (override));
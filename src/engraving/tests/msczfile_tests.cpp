@@ -24,9 +24,15 @@
 #include <QByteArray>
 
 #include "io/buffer.h"
+#include "io/file.h"
 
 #include "engraving/infrastructure/mscreader.h"
 #include "engraving/infrastructure/mscwriter.h"
+#include "engraving/dom/excerpt.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/rw/mscsaver.h"
+
+#include "utils/scorerw.h"
 
 using namespace muse;
 using namespace muse::io;
@@ -88,3 +94,166 @@ TEST_F(Engraving_MsczFileTests, MsczFile_WriteRead)
         EXPECT_EQ(imageData, originImageData);
     }
 }
+
+TEST_F(Engraving_MsczFileTests, MsczFile_DeferredWriteRead)
+{
+    //! CASE Writing datas with a deferred writer, the files are written to the device only by writeDeferredFiles
+
+    //! GIVEN Some datas
+
+    const ByteArray originScoreData("score");
+    const ByteArray originImageData("image");
+
+    //! DO Write datas
+    ByteArray msczData;
+    {
+        Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "simple1.mscz";
+        params.mode = MscIoMode::Zip;
+        params.deferred = true;
+
+        MscWriter writer(params);
+        writer.open();
+        EXPECT_TRUE(writer.isOpened());
+
+        writer.writeScoreFile(originScoreData);
+        writer.addImageFile(u"image1.png", originImageData);
+        writer.close();
+
+        EXPECT_FALSE(writer.isOpened());
+        EXPECT_TRUE(msczData.empty());
+
+        EXPECT_TRUE(writer.writeDeferredFiles());
+        EXPECT_FALSE(writer.hasError());
+    }
+
+    //! CHECK Read and compare with origin
+    {
+        Buffer buf(&msczData);
+        MscReader::Params params;
+        params.device = &buf;
+        params.filePath = "simple1.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscReader reader(params);
+        reader.open();
+
+        ByteArray scoreData = reader.readScoreFile();
+        EXPECT_EQ(scoreData, originScoreData);
+
+        std::vector<String> images = reader.imageFileNames();
+        ByteArray imageData = reader.readImageFile(u"image1.png");
+        EXPECT_EQ(images.size(), 1);
+        EXPECT_EQ(images.at(0), u"image1.png");
+        EXPECT_EQ(imageData, originImageData);
+    }
+}
+
+static bool writeMscz(MasterScore* score, ByteArray& msczData, bool deferred = false)
+{
+    Buffer buf(&msczData);
+    MscWriter::Params params;
+    params.device = &buf;
+    params.filePath = "parts.mscz";
+    params.mode = MscIoMode::Zip;
+    params.deferred = deferred;
+
+    MscWriter writer(params);
+    writer.open();
+    bool ok = MscSaver(muse::modularity::globalCtx()).writeMscz(score, writer, false);
+    writer.close();
+
+    if (ok && deferred) {
+        ok = writer.writeDeferredFiles();
+    }
+
+    return ok && !writer.hasError();
+}
+
+TEST_F(Engraving_MsczFileTests, MsczFile_SaveReloadAfterNonUndoChange)
+{
+    //! CASE A part changed outside of the undo stack is written again, not taken from its previous write
+
+    //! GIVEN A score with parts, saved once, so the written parts are kept
+    MasterScore* score = ScoreRW::readScore(u"parts_data/part-54346-parts.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->excerpts().empty());
+
+    Excerpt* excerpt = score->excerpts().front();
+    Score* partScore = excerpt->excerptScore();
+    ASSERT_TRUE(partScore);
+
+    ByteArray firstData;
+    ASSERT_TRUE(writeMscz(score, firstData));
+    EXPECT_EQ(excerpt->writeCache().scoreRevision, partScore->changesRevision());
+
+    //! DO Change the saved flags of the part, without the undo stack, and save again
+    const bool showInvisible = !partScore->isShowInvisible();
+    const bool showFrames = !partScore->showFrames();
+    partScore->setShowInvisible(showInvisible);
+    partScore->setShowFrames(showFrames);
+    partScore->setIsOpen(true);
+
+    EXPECT_NE(excerpt->writeCache().scoreRevision, partScore->changesRevision());
+
+    ByteArray secondData;
+    ASSERT_TRUE(writeMscz(score, secondData));
+
+    //! CHECK The reloaded part has the changes
+    ASSERT_TRUE(io::File::writeFile("nonundo_parts.mscz", secondData));
+    MasterScore* reloaded = ScoreRW::readScore(u"nonundo_parts.mscz", true);
+    ASSERT_TRUE(reloaded);
+    ASSERT_EQ(reloaded->excerpts().size(), score->excerpts().size());
+
+    Score* reloadedPart = reloaded->excerpts().front()->excerptScore();
+    ASSERT_TRUE(reloadedPart);
+    EXPECT_EQ(reloadedPart->isShowInvisible(), showInvisible);
+    EXPECT_EQ(reloadedPart->showFrames(), showFrames);
+    EXPECT_TRUE(reloadedPart->isOpen());
+
+    //! CHECK Other changes outside of the undo stack clear the written parts
+    score->invalidateWriteCaches();
+    EXPECT_EQ(excerpt->writeCache().scoreRevision, muse::nidx);
+    EXPECT_TRUE(excerpt->writeCache().scoreData.empty());
+
+    delete reloaded;
+    delete score;
+}
+
+TEST_F(Engraving_MsczFileTests, MsczFile_AutosaveReloadAfterNonUndoChange)
+{
+    //! CASE Autosave (a deferred write) after a change outside of the undo stack doesn't reuse the stale part
+
+    //! GIVEN A score with parts, autosaved once, so the written parts are kept
+    MasterScore* score = ScoreRW::readScore(u"parts_data/part-54346-parts.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->excerpts().empty());
+
+    Score* partScore = score->excerpts().front()->excerptScore();
+    ASSERT_TRUE(partScore);
+
+    ByteArray firstData;
+    ASSERT_TRUE(writeMscz(score, firstData, true));
+
+    //! DO Change a saved flag of the part without the undo stack, and autosave again
+    const bool markIrregularMeasures = !partScore->markIrregularMeasures();
+    partScore->setMarkIrregularMeasures(markIrregularMeasures);
+
+    ByteArray secondData;
+    ASSERT_TRUE(writeMscz(score, secondData, true));
+
+    //! CHECK The reloaded part has the change
+    ASSERT_TRUE(io::File::writeFile("nonundo_autosave.mscz", secondData));
+    MasterScore* reloaded = ScoreRW::readScore(u"nonundo_autosave.mscz", true);
+    ASSERT_TRUE(reloaded);
+    ASSERT_FALSE(reloaded->excerpts().empty());
+
+    Score* reloadedPart = reloaded->excerpts().front()->excerptScore();
+    ASSERT_TRUE(reloadedPart);
+    EXPECT_EQ(reloadedPart->markIrregularMeasures(), markIrregularMeasures);
+
+    delete reloaded;
+    delete score;
+}
@@ -0,0 +1,167 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "engraving/dom/excerpt.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/measure.h"
+#include "engraving/dom/system.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu::engraving;
+
+static const String MEASURE_DATA_DIR("measure_data/");
+static const String PARTS_DATA_DIR("parts_data/");
+
+//! NOTE Where every measure is laid out
+static std::vector<PointF> measurePositions(const Score* score)
+{
+    std::vector<PointF> positions;
+    for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        positions.push_back(m->system() ? m->canvasPos() : PointF());
+    }
+    return positions;
+}
+
+class Engraving_PendingLayoutTests : public ::testing::Test
+{
+};
+
+TEST_F(Engraving_PendingLayoutTests, FullLayoutClearsPending)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    //! [GIVEN] The score is laid out after reading
+    EXPECT_FALSE(score->hasPendingLayout());
+
+    //! [WHEN] A range is added and then the whole score is laid out
+    score->addPendingLayoutRange(Fraction(0, 1), Fraction(1, 1));
+    EXPECT_TRUE(score->hasPendingLayout());
+    score->doLayout();
+
+    //! [THEN] Nothing is pending anymore
+    EXPECT_FALSE(score->hasPendingLayout());
+
+    delete score;
+}
+
+TEST_F(Engraving_PendingLayoutTests, InvalidRangeRequestsFullLayout)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    //! [GIVEN] A range and then an invalid range (meaning "everything") are pending
+    score->addPendingLayoutRange(Fraction(0, 1), Fraction(1, 1));
+    score->addPendingLayoutRange(Fraction(-1, 1), Fraction(-1, 1));
+    EXPECT_TRUE(score->hasPendingLayout());
+
+    //! [THEN] A full layout is never split into steps
+    EXPECT_FALSE(score->doPendingLayoutStep(1));
+    EXPECT_TRUE(score->hasPendingLayout());
+
+    //! [THEN] doPendingLayout does the full layout
+    score->doPendingLayout();
+    EXPECT_FALSE(score->hasPendingLayout());
+
+    delete score;
+}
+
+TEST_F(Engraving_PendingLayoutTests, RangesAreMergedAndLaidOutInSteps)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* first = score->firstMeasure();
+    ASSERT_TRUE(first);
+    Measure* second = first->nextMeasure();
+    ASSERT_TRUE(second);
+    Measure* third = second->nextMeasure();
+    ASSERT_TRUE(third);
+    Measure* fourth = third->nextMeasure();
+    ASSERT_TRUE(fourth);
+
+    //! [GIVEN] Two separate edited ranges: the second and the fourth measure
+    score->addPendingLayoutRange(second->tick(), second->endTick());
+    score->addPendingLayoutRange(fourth->tick(), fourth->endTick());
+
+    //! [WHEN] The pending range is laid out one measure per step
+    int steps = 0;
+    while (score->doPendingLayoutStep(1)) {
+        ++steps;
+        ASSERT_LE(steps, 3);
+    }
+
+    //! [THEN] The merged range from the second to the fourth measure took three steps
+    EXPECT_EQ(steps, 3);
+    EXPECT_FALSE(score->hasPendingLayout());
+
+    delete score;
+}
+
+TEST_F(Engraving_PendingLayoutTests, LargeStepLaysOutWholeRange)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    //! [GIVEN] The whole score is pending as a range
+    score->addPendingLayoutRange(Fraction(0, 1), score->endTick());
+
+    //! [WHEN] A step is larger than the score
+    EXPECT_TRUE(score->doPendingLayoutStep(static_cast<int>(score->nmeasures()) + 1));
+
+    //! [THEN] Everything was laid out in one step
+    EXPECT_FALSE(score->hasPendingLayout());
+    EXPECT_FALSE(score->doPendingLayoutStep(1));
+
+    delete score;
+}
+
+TEST_F(Engraving_PendingLayoutTests, StyleChangeOfClosedPartIsLaidOut)
+{
+    MasterScore* score = ScoreRW::readScore(PARTS_DATA_DIR + u"part-54346-parts.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->excerpts().empty());
+
+    Score* part = score->excerpts().front()->excerptScore();
+    ASSERT_TRUE(part);
+    part->doLayout();
+
+    //! [GIVEN] A laid out part with nothing pending
+    const std::vector<PointF> positionsBefore = measurePositions(part);
+    EXPECT_FALSE(part->hasPendingLayout());
+
+    //! [WHEN] Only its style changes, which is not recorded as pending, and it is laid out for an export
+    part->style().set(Sid::spatium, part->style().spatium() * 2);
+    part->doPendingLayout();
+    const std::vector<PointF> positionsExported = measurePositions(part);
+
+    //! [THEN] The export has the style change, the same as a full layout
+    EXPECT_NE(positionsExported, positionsBefore);
+
+    part->doLayout();
+    EXPECT_EQ(positionsExported, measurePositions(part));
+
+    delete score;
+}
@@ -32,6 +32,9 @@
 #include "engraving/dom/part.h"
 #include "engraving/dom/measure.h"
 #include "engraving/dom/chord.h"
+#include "engraving/dom/dynamic.h"
+#include "engraving/dom/segment.h"
+#include "engraving/dom/tempotext.h"
 
 #include "engraving/playback/playbackmodel.h"
 
@@ -86,6 +89,56 @@ protected:
     std::shared_ptr<NiceMock<ArticulationProfilesRepositoryMock> > m_repositoryMock = nullptr;
 };
 
+template<typename T>
+static T* findAnnotation(const Score* score, ElementType type, size_t nth = 0)
+{
+    for (const Segment* segment = score->firstSegment(SegmentType::ChordRest); segment; segment = segment->next1()) {
+        for (EngravingItem* item : segment->annotations()) {
+            if (item->type() != type) {
+                continue;
+            }
+
+            if (nth == 0) {
+                return static_cast<T*>(item);
+            }
+
+            --nth;
+        }
+    }
+
+    return nullptr;
+}
+
+static void checkPlaybackDataEqual(const PlaybackData& actual, const PlaybackData& expected)
+{
+    EXPECT_EQ(actual.dynamics, expected.dynamics);
+
+    ASSERT_EQ(actual.originEvents.size(), expected.originEvents.size());
+
+    auto expectedIt = expected.originEvents.cbegin();
+    for (auto actualIt = actual.originEvents.cbegin(); actualIt != actual.originEvents.cend(); ++actualIt, ++expectedIt) {
+        EXPECT_EQ(actualIt->first, expectedIt->first);
+        ASSERT_EQ(actualIt->second.size(), expectedIt->second.size());
+
+        for (size_t i = 0; i < actualIt->second.size(); ++i) {
+            const PlaybackEvent& actualEvent = actualIt->second.at(i);
+            const PlaybackEvent& expectedEvent = expectedIt->second.at(i);
+            ASSERT_EQ(actualEvent.index(), expectedEvent.index());
+
+            if (!std::holds_alternative<mpe::NoteEvent>(actualEvent)) {
+                continue;
+            }
+
+            const mpe::NoteEvent& actualNote = std::get<mpe::NoteEvent>(actualEvent);
+            const mpe::NoteEvent& expectedNote = std::get<mpe::NoteEvent>(expectedEvent);
+            EXPECT_EQ(actualNote.arrangementCtx().actualTimestamp, expectedNote.arrangementCtx().actualTimestamp);
+            EXPECT_EQ(actualNote.arrangementCtx().actualDuration, expectedNote.arrangementCtx().actualDuration);
+            EXPECT_EQ(actualNote.pitchCtx().nominalPitchLevel, expectedNote.pitchCtx().nominalPitchLevel);
+            EXPECT_EQ(actualNote.expressionCtx().nominalDynamicLevel, expectedNote.expressionCtx().nominalDynamicLevel);
+        }
+    }
+}
+
 /**
  * @brief PlaybackModelTests_SimpleRepeat
  * @details In this case we're building up a playback model of a simple score - Violin, 4/4, 120bpm, Treble Cleff, 4 measures
@@ -1406,3 +1459,133 @@ TEST_F(Engraving_PlaybackModelTests, Playback_Setup_Data_MultiInstrument)
         }
     }
 }
+
+/**
+ * @brief PlaybackModelTests_Incremental_Tempo_Change
+ * @details Changing a tempo marking reloads the events from the change point onwards only.
+ *          The result must be the same as loading the playback model for the changed score from scratch
+ */
+TEST_F(Engraving_PlaybackModelTests, Incremental_Tempo_Change)
+{
+    // [GIVEN] Score with tempo changes in the middle of tied notes
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "tempo_changes_during_notes/tempo_changes_during_notes.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+
+    const Part* part = score->parts().at(0);
+
+    m_defaultProfile->setPattern(ArticulationType::Standard, buildTestArticulationPattern());
+    m_defaultProfile->setPattern(ArticulationType::Tremolo8th, buildTestArticulationPattern());
+    m_defaultProfile->setPattern(ArticulationType::Pedal, buildTestArticulationPattern());
+    ON_CALL(*m_repositoryMock, defaultProfile(_)).WillByDefault(Return(m_defaultProfile));
+
+    // [GIVEN] The playback model is loaded before the change
+    PlaybackModel model(modularity::globalCtx());
+    model.profilesRepository.set(m_repositoryMock);
+    model.load(score);
+
+    // [WHEN] The second tempo marking is changed
+    TempoText* tempoText = findAnnotation<TempoText>(score, ElementType::TEMPO_TEXT, 1);
+    ASSERT_TRUE(tempoText);
+
+    score->startCmd(TranslatableString::untranslatable("Playback model tests"));
+    tempoText->undoChangeProperty(Pid::TEMPO, PropertyValue(BeatsPerSecond(3.0)));
+    score->endCmd();
+
+    // [WHEN] Another playback model is loaded from scratch
+    PlaybackModel expectedModel(modularity::globalCtx());
+    expectedModel.profilesRepository.set(m_repositoryMock);
+    expectedModel.load(score);
+
+    // [THEN] The incrementally updated events match the full reload
+    checkPlaybackDataEqual(model.resolveTrackPlaybackData(part->id(), part->instrumentId()),
+                           expectedModel.resolveTrackPlaybackData(part->id(), part->instrumentId()));
+    checkPlaybackDataEqual(model.resolveTrackPlaybackData(model.metronomeTrackId()),
+                           expectedModel.resolveTrackPlaybackData(expectedModel.metronomeTrackId()));
+}
+
+/**
+ * @brief PlaybackModelTests_Incremental_Dynamic_Change
+ * @details Changing a dynamic marking reloads the events of its part from the change point onwards only,
+ *          including the crescendo leading to it. The result must be the same as loading the playback model from scratch
+ */
+TEST_F(Engraving_PlaybackModelTests, Incremental_Dynamic_Change)
+{
+    // [GIVEN] Score with piano marking at the start, then crescendo to forte,
+    //         then again crescendo, followed by sudden pianissimo
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "dynamics/dynamics.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+
+    const Part* part = score->parts().at(0);
+
+    m_defaultProfile->setPattern(ArticulationType::Standard, buildTestArticulationPattern());
+    ON_CALL(*m_repositoryMock, defaultProfile(_)).WillByDefault(Return(m_defaultProfile));
+
+    // [GIVEN] The playback model is loaded before the change
+    PlaybackModel model(modularity::globalCtx());
+    model.profilesRepository.set(m_repositoryMock);
+    model.load(score);
+
+    // [WHEN] The forte marking is changed to fortissimo
+    Dynamic* dynamic = findAnnotation<Dynamic>(score, ElementType::DYNAMIC, 1);
+    ASSERT_TRUE(dynamic);
+
+    score->startCmd(TranslatableString::untranslatable("Playback model tests"));
+    dynamic->undoChangeProperty(Pid::DYNAMIC_TYPE, PropertyValue(DynamicType::FF));
+    score->endCmd();
+
+    // [WHEN] Another playback model is loaded from scratch
+    PlaybackModel expectedModel(modularity::globalCtx());
+    expectedModel.profilesRepository.set(m_repositoryMock);
+    expectedModel.load(score);
+
+    // [THEN] The incrementally updated events and dynamics match the full reload
+    checkPlaybackDataEqual(model.resolveTrackPlaybackData(part->id(), part->instrumentId()),
+                           expectedModel.resolveTrackPlaybackData(part->id(), part->instrumentId()));
+}
+
+/**
+ * @brief PlaybackModelTests_Incremental_Dynamic_Change_After_Hairpin
+ * @details Changing the dynamic at the end of a hairpin reloads the events from the start of the hairpin,
+ *          which begins in the measure before the change. The result must be the same as loading the playback model from scratch
+ */
+TEST_F(Engraving_PlaybackModelTests, Incremental_Dynamic_Change_After_Hairpin)
+{
+    // [GIVEN] Score with piano marking at the start, then crescendo to forte,
+    //         then again crescendo, followed by sudden pianissimo
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "dynamics/dynamics.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+
+    const Part* part = score->parts().at(0);
+
+    m_defaultProfile->setPattern(ArticulationType::Standard, buildTestArticulationPattern());
+    ON_CALL(*m_repositoryMock, defaultProfile(_)).WillByDefault(Return(m_defaultProfile));
+
+    // [GIVEN] The playback model is loaded before the change
+    PlaybackModel model(modularity::globalCtx());
+    model.profilesRepository.set(m_repositoryMock);
+    model.load(score);
+
+    // [WHEN] The pianissimo marking ending the second crescendo is changed to fortissimo
+    Dynamic* dynamic = findAnnotation<Dynamic>(score, ElementType::DYNAMIC, 2);
+    ASSERT_TRUE(dynamic);
+    ASSERT_EQ(dynamic->dynamicType(), DynamicType::PP);
+
+    score->startCmd(TranslatableString::untranslatable("Playback model tests"));
+    dynamic->undoChangeProperty(Pid::DYNAMIC_TYPE, PropertyValue(DynamicType::FF));
+    score->endCmd();
+
+    // [WHEN] Another playback model is loaded from scratch
+    PlaybackModel expectedModel(modularity::globalCtx());
+    expectedModel.profilesRepository.set(m_repositoryMock);
+    expectedModel.load(score);
+
+    // [THEN] The crescendo crossing into the changed measure is rendered towards the new dynamic, as in the full reload
+    checkPlaybackDataEqual(model.resolveTrackPlaybackData(part->id(), part->instrumentId()),
+                           expectedModel.resolveTrackPlaybackData(part->id(), part->instrumentId()));
+}
@@ -22,6 +22,8 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include "realfn.h"
 
 #include "engraving/dom/tempo.h"
@@ -35,6 +37,31 @@ static const String TEMPOMAP_TEST_FILES_DIR("tempomap_data/");
 
 static constexpr double TEMPO_ERROR(0.000001);
 
+//! NOTE The linear search that TempoMap::time2tick used before the binary search
+static int referenceTime2tick(const TempoMap& tempoMap, double time)
+{
+    int tick     = 0;
+    double delta = 0.0;
+    BeatsPerSecond tempo = 2.0;
+
+    for (auto e = tempoMap.begin(); e != tempoMap.end(); ++e) {
+        if ((time <= e->second.time) && (time > e->second.time - e->second.pause)) {
+            delta = (time - (e->second.time - e->second.pause) + delta);
+            break;
+        }
+        if (e->second.time >= time) {
+            break;
+        }
+        delta = e->second.time;
+        tick  = e->first;
+        tempo = e->second.tempo;
+    }
+    delta = time - delta;
+    tick += lrint(delta * tempoMap.tempoMultiplier().val * Constants::DIVISION * tempo.val);
+
+    return tick;
+}
+
 class Engraving_TempoMapTests : public ::testing::Test
 {
 protected:
@@ -274,3 +301,59 @@ TEST_F(Engraving_TempoMapTests, GRADUAL_TEMPO_CHANGE_DOESNT_OVERWRITE_OTHER_TEMP
 
     delete score;
 }
+
+/**
+ * @brief TempoMapTests_TIME2TICK_MATCHES_LINEAR_SEARCH
+ * @details Random tempo maps with tempo changes and pauses, like the ones gradual tempo changes generate,
+ *          must give the same ticks as the linear search, at the events, inside the pauses and in between
+ */
+TEST_F(Engraving_TempoMapTests, TIME2TICK_MATCHES_LINEAR_SEARCH)
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> tickStep(1, 4 * Constants::DIVISION);
+    std::uniform_real_distribution<double> bpm(20.0, 300.0);
+    std::uniform_int_distribution<int> pauseChance(0, 9);
+    std::uniform_real_distribution<double> pause(0.01, 3.0);
+
+    for (int round = 0; round < 20; ++round) {
+        // [GIVEN] A random tempo map
+        TempoMap tempoMap;
+        if (round % 2) {
+            tempoMap.setTempoMultiplier(BeatsPerSecond(0.5 + round * 0.1));
+        }
+
+        int tick = 0;
+        for (int i = 0; i < 200; ++i) {
+            tempoMap.setTempo(tick, BeatsPerSecond::fromBPM(bpm(random)));
+            if (pauseChance(random) == 0) {
+                tempoMap.setPause(tick + tickStep(random), pause(random));
+            }
+            tick += tickStep(random);
+        }
+
+        // [THEN] time2tick matches the linear search at the event times, inside the pauses and at random times
+        std::vector<double> times;
+        for (const auto& pair : tempoMap) {
+            times.push_back(pair.second.time);
+            times.push_back(pair.second.time - pair.second.pause / 2);
+            times.push_back(pair.second.time + 0.001);
+        }
+
+        const double endTime = tempoMap.tick2time(tick);
+        std::uniform_real_distribution<double> anyTime(-1.0, endTime + 1.0);
+        for (int i = 0; i < 1000; ++i) {
+            times.push_back(anyTime(random));
+        }
+
+        for (double time : times) {
+            EXPECT_EQ(tempoMap.time2tick(time), referenceTime2tick(tempoMap, time)) << "time: " << time;
+        }
+
+        // [THEN] Converting the tick times back gives the ticks
+        for (const auto& pair : tempoMap) {
+            if (pair.second.pause == 0.0) {
+                EXPECT_EQ(tempoMap.time2tick(tempoMap.tick2time(pair.first)), pair.first);
+            }
+        }
+    }
+}
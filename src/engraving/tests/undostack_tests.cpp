@@ -0,0 +1,201 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/measure.h"
+#include "engraving/editing/editproperty.h"
+#include "engraving/editing/transaction/undostack.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu::engraving;
+
+static const String MEASURE_DATA_DIR("measure_data/");
+
+class Engraving_UndoStackTests : public ::testing::Test
+{
+public:
+    static double stretch(const Measure* m)
+    {
+        return m->getProperty(Pid::USER_STRETCH).toDouble();
+    }
+
+    static void changeStretch(MasterScore* score, Measure* m, double value)
+    {
+        score->startCmd(TranslatableString::untranslatable("Undo stack tests"));
+        score->undo(new ChangeProperty(m, Pid::USER_STRETCH, value));
+        score->endCmd();
+    }
+};
+
+TEST_F(Engraving_UndoStackTests, ChangePropertyChainIsCompacted)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* m = score->firstMeasure();
+    ASSERT_TRUE(m);
+    const double original = stretch(m);
+
+    //! [WHEN] The same property is changed several times in one transaction
+    score->startCmd(TranslatableString::untranslatable("Undo stack tests"));
+    score->undo(new ChangeProperty(m, Pid::USER_STRETCH, 1.5));
+    score->undo(new ChangeProperty(m, Pid::USER_STRETCH, 2.0));
+    score->undo(new ChangeProperty(m, Pid::USER_STRETCH, 2.5));
+    score->endCmd();
+
+    //! [THEN] The transaction keeps one command
+    const UndoableTransaction* transaction = score->undoStack()->last();
+    ASSERT_TRUE(transaction);
+    EXPECT_EQ(transaction->commands().size(), 1);
+    EXPECT_DOUBLE_EQ(stretch(m), 2.5);
+
+    //! [THEN] Undo restores the value from before the first change
+    score->undoRedo(true, nullptr);
+    EXPECT_DOUBLE_EQ(stretch(m), original);
+
+    //! [THEN] Redo restores the last value
+    score->undoRedo(false, nullptr);
+    EXPECT_DOUBLE_EQ(stretch(m), 2.5);
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoStackTests, DifferentObjectsAreNotCompacted)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* m1 = score->firstMeasure();
+    ASSERT_TRUE(m1);
+    Measure* m2 = m1->nextMeasure();
+    ASSERT_TRUE(m2);
+
+    score->startCmd(TranslatableString::untranslatable("Undo stack tests"));
+    score->undo(new ChangeProperty(m1, Pid::USER_STRETCH, 1.5));
+    score->undo(new ChangeProperty(m2, Pid::USER_STRETCH, 2.0));
+    score->endCmd();
+
+    const UndoableTransaction* transaction = score->undoStack()->last();
+    ASSERT_TRUE(transaction);
+    EXPECT_EQ(transaction->commands().size(), 2);
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoStackTests, TrimHistoryKeepsIndicesConsistent)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* m = score->firstMeasure();
+    ASSERT_TRUE(m);
+    UndoStack* stack = score->undoStack();
+
+    //! [GIVEN] Five transactions, the last one undone
+    for (int i = 1; i <= 5; ++i) {
+        changeStretch(score, m, 1.0 + i);
+    }
+    score->undoRedo(true, nullptr);
+    ASSERT_EQ(stack->size(), 5);
+    ASSERT_EQ(stack->currentIndex(), 4);
+    EXPECT_DOUBLE_EQ(stretch(m), 5.0);
+
+    //! [WHEN] The history is trimmed to one command
+    stack->trimHistory(1);
+
+    //! [THEN] The two most recent done transactions and the redo transaction are kept, at the same indices
+    EXPECT_EQ(stack->firstIndex(), 2);
+    EXPECT_EQ(stack->size(), 5);
+    EXPECT_EQ(stack->currentIndex(), 4);
+    EXPECT_FALSE(stack->lastAtIndex(2));
+    EXPECT_TRUE(stack->lastAtIndex(3));
+    EXPECT_TRUE(stack->canRedo());
+
+    //! [THEN] Redo and undo still address the right transactions
+    score->undoRedo(false, nullptr);
+    EXPECT_DOUBLE_EQ(stretch(m), 6.0);
+
+    score->undoRedo(true, nullptr);
+    score->undoRedo(true, nullptr);
+    score->undoRedo(true, nullptr);
+    EXPECT_DOUBLE_EQ(stretch(m), 3.0);
+    EXPECT_FALSE(stack->canUndo());
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoStackTests, TrimHistoryWithoutLimitKeepsEverything)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* m = score->firstMeasure();
+    ASSERT_TRUE(m);
+    UndoStack* stack = score->undoStack();
+
+    for (int i = 1; i <= 5; ++i) {
+        changeStretch(score, m, 1.0 + i);
+    }
+
+    stack->trimHistory(0);
+
+    EXPECT_EQ(stack->size(), 5);
+    EXPECT_EQ(stack->currentIndex(), 5);
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoStackTests, TrimHistoryKeepsHeldIndexForMerge)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    ASSERT_TRUE(score);
+
+    Measure* m = score->firstMeasure();
+    ASSERT_TRUE(m);
+    UndoStack* stack = score->undoStack();
+
+    //! [GIVEN] An index held across several transactions, as text editing does
+    changeStretch(score, m, 2.0);
+    changeStretch(score, m, 3.0);
+    const size_t startIdx = stack->currentIndex();
+    changeStretch(score, m, 4.0);
+    changeStretch(score, m, 5.0);
+    changeStretch(score, m, 6.0);
+
+    //! [WHEN] The history is trimmed so that only the held transactions are kept
+    stack->trimHistory(3);
+    ASSERT_EQ(stack->firstIndex(), startIdx);
+
+    //! [THEN] Merging from the held index joins the transactions done since then
+    stack->mergeTransactions(startIdx);
+    EXPECT_EQ(stack->currentIndex(), startIdx + 1);
+    EXPECT_EQ(stack->last()->commands().size(), 3);
+
+    score->undoRedo(true, nullptr);
+    EXPECT_DOUBLE_EQ(stretch(m), 3.0);
+    EXPECT_FALSE(stack->canUndo());
+
+    delete score;
+}
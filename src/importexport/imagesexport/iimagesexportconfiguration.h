@@ -63,6 +63,8 @@ public:
     virtual void setExportSvgWithTransparentBackground(bool transparent) = 0;
     virtual bool exportSvgWithIllustratorCompat() const = 0;
     virtual void setExportSvgWithIllustratorCompat(bool compat) = 0;
+    virtual bool exportSvgWithSymbolDefs() const = 0;
+    virtual void setExportSvgWithSymbolDefs(bool useDefs) = 0;
 
     virtual int trimMarginPixelSize() const = 0;
     virtual void setTrimMarginPixelSize(std::optional<int> pixelSize) = 0;
@@ -53,6 +53,8 @@ public:
     void setExportSvgWithTransparentBackground(bool transparent) override;
     bool exportSvgWithIllustratorCompat() const override;
     void setExportSvgWithIllustratorCompat(bool compat) override;
+    bool exportSvgWithSymbolDefs() const override;
+    void setExportSvgWithSymbolDefs(bool useDefs) override;
 
     int trimMarginPixelSize() const override;
     void setTrimMarginPixelSize(std::optional<int> pixelSize) override;
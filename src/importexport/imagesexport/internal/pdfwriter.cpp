@@ -27,6 +27,8 @@
 
 #include "engraving/dom/masterscore.h"
 
+#include "../pdfwritersettings.h"
+
 #include "log.h"
 
 using namespace mu::iex::imagesexport;
@@ -58,7 +60,8 @@ Ret PdfWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
     buf.open(QIODevice::WriteOnly);
 
     QPdfWriter pdfWriter(&buf);
-    preparePdfWriter(pdfWriter, notation->projectWorkTitleAndPartName(), notation->painting()->pageSizeInch().toQSizeF());
+    preparePdfWriter(pdfWriter, makePdfWriterSettings(*configuration(), *application(), notation->projectWorkTitleAndPartName(),
+                                                      notation->painting()->pageSizeInch().toQSizeF()));
 
     Painter painter(&pdfWriter, "pdfwriter");
     if (!painter.isActive()) {
@@ -110,7 +113,8 @@ Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destin
     buf.open(QIODevice::WriteOnly);
 
     QPdfWriter pdfWriter(&buf);
-    preparePdfWriter(pdfWriter, firstNotation->projectWorkTitle(), firstNotation->painting()->pageSizeInch().toQSizeF());
+    preparePdfWriter(pdfWriter, makePdfWriterSettings(*configuration(), *application(), firstNotation->projectWorkTitle(),
+                                                      firstNotation->painting()->pageSizeInch().toQSizeF()));
 
     Painter painter(&pdfWriter, "pdfwriter");
     if (!painter.isActive()) {
@@ -146,18 +150,3 @@ Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destin
 
     return true;
 }
-
-void PdfWriter::preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const
-{
-    pdfWriter.setResolution(configuration()->exportPdfDpiResolution());
-    pdfWriter.setCreator(QString("MuseScore Studio Version: ") + application()->version().toString().toQString());
-    pdfWriter.setTitle(title);
-    pdfWriter.setPageMargins(QMarginsF());
-    pdfWriter.setPageLayout(QPageLayout(QPageSize(size, QPageSize::Inch), QPageLayout::Orientation::Portrait, QMarginsF()));
-
-    if (configuration()->exportPdfWithGrayscale()) {
-        pdfWriter.setColorModel(QPdfWriter::ColorModel::Grayscale);
-    } else {
-        pdfWriter.setColorModel(QPdfWriter::ColorModel::Auto);
-    }
-}
@@ -28,8 +28,6 @@
 #include "modularity/ioc.h"
 #include "global/iapplication.h"
 
-class QPdfWriter;
-
 namespace mu::iex::imagesexport {
 class PdfWriter : public AbstractImageWriter
 {
@@ -41,8 +39,5 @@ public:
     muse::Ret write(notation::INotationPtr notation, muse::io::IODevice& dstDevice, const Options& options = Options()) override;
     muse::Ret writeList(const notation::INotationPtrList& notations, muse::io::IODevice& dstDevice,
                         const Options& options = Options()) override;
-
-private:
-    void preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const;
 };
 }
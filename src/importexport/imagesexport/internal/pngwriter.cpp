@@ -23,6 +23,7 @@
 #include "pngwriter.h"
 
 #include <cmath>
+#include <cstring>
 #include <QImage>
 #include <QBuffer>
 
@@ -52,27 +53,84 @@ Ret PngWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
     opt.toPage = opt.fromPage;
     opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
     opt.deviceDpi = CANVAS_DPI;
-    opt.printPageBackground = false; // Printed by us using image.fill
+    opt.printPageBackground = false; // Printed by us using tile fill
 
     const SizeF pageSizeInch = notation->painting()->pageSizeInch(opt);
 
     int width = std::lrint(pageSizeInch.width() * CANVAS_DPI);
     int height = std::lrint(pageSizeInch.height() * CANVAS_DPI);
+    if (width <= 0 || height <= 0) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    const bool TRANSPARENT_BACKGROUND = muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
+                                                    Val(configuration()->exportPngWithTransparentBackground())).toBool();
+    const bool GRAYSCALE = configuration()->exportPngWithGrayscale();
+
+    //! NOTE The page image is kept in the format the PNG encoder writes as is,
+    //! so that saving doesn't make a converted copy of the whole page.
+    //! An opaque grayscale page takes one byte per pixel.
+    QImage::Format pageFormat = QImage::Format_RGB32;
+    if (TRANSPARENT_BACKGROUND) {
+        pageFormat = QImage::Format_ARGB32;
+    } else if (GRAYSCALE) {
+        pageFormat = QImage::Format_Grayscale8;
+    }
+
+    QImage image(width, height, pageFormat);
+    if (image.isNull()) {
+        LOGE() << "failed to allocate image " << width << "x" << height;
+        return make_ret(Ret::Code::InternalError);
+    }
 
-    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
     image.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / mu::engraving::INCH));
     image.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / mu::engraving::INCH));
 
-    const bool TRANSPARENT_BACKGROUND = muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
-                                                    Val(configuration()->exportPngWithTransparentBackground())).toBool();
-    image.fill(TRANSPARENT_BACKGROUND ? Qt::transparent : Qt::white);
+    //! NOTE The page is painted in horizontal tiles through one buffer, reused for the tiles of this page only;
+    //! each tile only paints the items that intersect it
+    const int tileHeight = std::min(TILE_HEIGHT, height);
+    QImage tile(width, tileHeight, QImage::Format_ARGB32_Premultiplied);
+    if (tile.isNull()) {
+        LOGE() << "failed to allocate tile " << width << "x" << tileHeight;
+        return make_ret(Ret::Code::InternalError);
+    }
 
-    muse::draw::Painter painter(&image, "pngwriter");
+    for (int tileTop = 0; tileTop < height; tileTop += tileHeight) {
+        const int rows = std::min(tileHeight, height - tileTop);
 
-    notation->painting()->paintPng(&painter, opt);
+        tile.fill(TRANSPARENT_BACKGROUND ? Qt::transparent : Qt::white);
 
-    if (configuration()->exportPngWithGrayscale()) {
-        convertImageToGrayscale(image);
+        {
+            //! NOTE In image pixels, the painting maps it to the page with its own viewport transform
+            INotationPainting::Options tileOpt = opt;
+            tileOpt.tileRect = RectF(0.0, tileTop, width, rows);
+
+            muse::draw::Painter painter(&tile, "pngwriter");
+            notation->painting()->paintPng(&painter, tileOpt);
+        }
+
+        for (int y = 0; y < rows; ++y) {
+            QRgb* tileLine = reinterpret_cast<QRgb*>(tile.scanLine(y));
+            uchar* pageLine = image.scanLine(tileTop + y);
+
+            if (pageFormat == QImage::Format_Grayscale8) {
+                convertLineToGray8(tileLine, pageLine, width);
+                continue;
+            }
+
+            if (GRAYSCALE) {
+                convertLineToGrayscale(tileLine, width);
+            }
+
+            if (pageFormat == QImage::Format_ARGB32) {
+                QRgb* pageRgb = reinterpret_cast<QRgb*>(pageLine);
+                for (int x = 0; x < width; ++x) {
+                    pageRgb[x] = qUnpremultiply(tileLine[x]);
+                }
+            } else {
+                std::memcpy(pageLine, tileLine, size_t(width) * sizeof(QRgb));
+            }
+        }
     }
 
     QByteArray qdata;
@@ -87,15 +145,23 @@ Ret PngWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
     return true;
 }
 
-void PngWriter::convertImageToGrayscale(QImage& image)
+//! NOTE Same weights as qGray, but without per pixel function calls and branches,
+//! so that the compiler can vectorize the loops
+
+void PngWriter::convertLineToGrayscale(QRgb* line, int width)
 {
     // We convert every pixel to gray, preserving alpha channel (necessary for transparent background)
-    for (int y = 0; y < image.height(); ++y) {
-        QRgb* scanLine = reinterpret_cast<QRgb*>(image.scanLine(y));
-        for (int x = 0; x < image.width(); ++x) {
-            QRgb& pixel = scanLine[x];
-            uint ci = uint(qGray(pixel));
-            pixel = qRgba(ci, ci, ci, qAlpha(pixel));
-        }
+    for (int x = 0; x < width; ++x) {
+        const uint32_t pixel = line[x];
+        const uint32_t gray = (((pixel >> 16) & 0xff) * 11 + ((pixel >> 8) & 0xff) * 16 + (pixel & 0xff) * 5) >> 5;
+        line[x] = (pixel & 0xff000000) | (gray << 16) | (gray << 8) | gray;
+    }
+}
+
+void PngWriter::convertLineToGray8(const QRgb* line, uchar* gray, int width)
+{
+    for (int x = 0; x < width; ++x) {
+        const uint32_t pixel = line[x];
+        gray[x] = uchar((((pixel >> 16) & 0xff) * 11 + ((pixel >> 8) & 0xff) * 16 + (pixel & 0xff) * 5) >> 5);
     }
 }
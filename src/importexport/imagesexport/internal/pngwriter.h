@@ -27,7 +27,7 @@
 #include "../iimagesexportconfiguration.h"
 #include "modularity/ioc.h"
 
-class QImage;
+#include <QImage>
 
 namespace mu::iex::imagesexport {
 class PngWriter : public AbstractImageWriter
@@ -39,6 +39,9 @@ public:
     muse::Ret write(notation::INotationPtr notation, muse::io::IODevice& dstDevice, const Options& options = Options()) override;
 
 private:
-    void convertImageToGrayscale(QImage& image);
+    static constexpr int TILE_HEIGHT = 256;
+
+    static void convertLineToGrayscale(QRgb* line, int width);
+    static void convertLineToGray8(const QRgb* line, uchar* gray, int width);
 };
 }
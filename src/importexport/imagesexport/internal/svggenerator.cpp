@@ -22,6 +22,7 @@
 
 #include <QBuffer>
 #include <QFile>
+#include <QHash>
 #include <QMimeDatabase>
 #include <QMimeType>
 #include <QPaintEngine>
@@ -182,9 +183,7 @@ public:
     QTextStream* stream;
     int resolution;
 
-    QString header;
 //    QString defs; // NEEDED FOR GRADIENTS
-    QString body;
 
     QBrush brush;
     QPen pen;
@@ -289,6 +288,9 @@ protected:
 #define SVG_DESC_END    "</desc>"
 
 #define SVG_IMAGE       "<image"
+#define SVG_USE         "<use"
+#define SVG_HREF        " xlink:href=\"#"
+#define SVG_SYMBOL_ID   "s"
 #define SVG_PATH        "<path"
 #define SVG_POLYLINE    "<polyline"
 
@@ -332,6 +334,15 @@ private:
     void defineClipPath(const QPainterPath& clipPath);
     void setClipPath();
 
+// Glyph runs already written to <defs>, keyed by font and text; 0 means an empty outline
+    bool _useSymbolDefs = false;
+    int _curSymbolId = 0;
+    QHash<QString, int> _symbolIds;
+    int defineSymbol(const QTextItem& textItem);
+
+// The transform="matrix()" attribute of the current state, if any
+    QString _matrixString;
+
 public:
     SvgPaintEngine()
         : QPaintEngine(svgEngineFeatures()),
@@ -350,6 +361,7 @@ public:
     void drawPixmap(const QRectF& r, const QPixmap& pm, const QRectF& sr) override;
     void drawPolygon(const QPointF* points, int pointCount, PolygonDrawMode mode) override;
     void drawImage(const QRectF& r, const QImage& pm, const QRectF& sr, Qt::ImageConversionFlags flags = Qt::AutoColor) override;
+    void drawTextItem(const QPointF& p, const QTextItem& textItem) override;
 
     QPaintEngine::Type type() const override { return QPaintEngine::SVG; }
 
@@ -394,6 +406,7 @@ public:
     }
 
     void setReplaceClipPathWithMask(bool v) { _replaceClipPathWithMask = v; }
+    void setUseSymbolDefs(bool v) { _useSymbolDefs = v; }
 
 ///////////////////////////////////////////////////////////////////////////////
 // UNUSED GRADIENT CODE:
@@ -1041,6 +1054,11 @@ void SvgGenerator::setReplaceClipPathWithMask(bool v)
     static_cast<SvgPaintEngine*>(paintEngine())->setReplaceClipPathWithMask(v);
 }
 
+void SvgGenerator::setUseSymbolDefs(bool v)
+{
+    static_cast<SvgPaintEngine*>(paintEngine())->setUseSymbolDefs(v);
+}
+
 /*****************************************************************************
  * class SvgPaintEngine
  */
@@ -1066,8 +1084,15 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         return false;
     }
 
+    // Stream straight to the output device, nothing is kept in memory
+    d->stream = new QTextStream(d->outputDevice);
+    d->stream->setEncoding(QStringConverter::Utf8);
+
+    _curClipPathId = 0;
+    _curSymbolId = 0;
+    _symbolIds.clear();
+
     // Stream the headers
-    d->stream = new QTextStream(&d->header);
     stream() << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>" << Qt::endl << SVG_BEGIN;
     if (d->viewBox.isValid()) {
         // viewBox has floating point values, size width/height is integer
@@ -1089,12 +1114,6 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         stream() << SVG_DESC_BEGIN << d->attributes.description.toHtmlEscaped() << SVG_DESC_END << Qt::endl;
     }
 
-// <defs> is currently empty. It's necessary for gradients.
-//    d->stream->setString(&d->defs);
-//    *d->stream << "<defs>\n";
-
-    // Point the stream at the body string, for other functions to populate
-    d->stream->setString(&d->body);
     return true;
 }
 
@@ -1102,21 +1121,13 @@ bool SvgPaintEngine::end()
 {
     Q_D(SvgPaintEngine);
 
-// <defs> is currently empty
-//    d->stream->setString(&d->defs);
-//    stream() << "</defs>\n";
-
-    // Point the stream at the real output device (the .svg file)
-    d->stream->setDevice(d->outputDevice);
-    d->stream->setEncoding(QStringConverter::Utf8);
-
-    // Stream our strings out to the device, in order
-    stream() << d->header;
-//    stream() << d->defs;
-    stream() << d->body;
     stream() << SVG_END << Qt::endl;
+    d->stream->flush();
 
     delete d->stream;
+    d->stream = nullptr;
+
+    _symbolIds.clear();
     return true;
 }
 
@@ -1182,6 +1193,7 @@ void SvgPaintEngine::updateState(const QPaintEngineState& s)
 {
     // Always start fresh
     stateString.clear();
+    _matrixString.clear();
 
     // stateString = Attribute Settings
 
@@ -1221,12 +1233,14 @@ void SvgPaintEngine::updateState(const QPaintEngineState& s)
         // Other transformations are more straightforward with a full matrix
         _dx = 0;
         _dy = 0;
-        stateStream << SVG_MATRIX << t.m11() << SVG_COMMA
-                    << t.m12() << SVG_COMMA
-                    << t.m21() << SVG_COMMA
-                    << t.m22() << SVG_COMMA
-                    << t.m31() << SVG_COMMA
-                    << t.m32() << SVG_RPAREN_QUOTE;
+        QTextStream matrixStream(&_matrixString);
+        matrixStream << SVG_MATRIX << t.m11() << SVG_COMMA
+                     << t.m12() << SVG_COMMA
+                     << t.m21() << SVG_COMMA
+                     << t.m22() << SVG_COMMA
+                     << t.m31() << SVG_COMMA
+                     << t.m32() << SVG_RPAREN_QUOTE;
+        stateStream << _matrixString;
     }
 }
 
@@ -1254,6 +1268,75 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
     stream() << SVG_ELEMENT_END << Qt::endl;
 }
 
+void SvgPaintEngine::drawTextItem(const QPointF& p, const QTextItem& textItem)
+{
+    // Clipped text is rare, keep it inline
+    if (!_useSymbolDefs || !painter()->clipPath().isEmpty()) {
+        QPaintEngine::drawTextItem(p, textItem);
+        return;
+    }
+
+    const int symbolId = defineSymbol(textItem);
+    if (symbolId == 0) {
+        return;
+    }
+
+    // Like QPaintEngine::drawTextItem(), text is filled with the pen color and not stroked
+    const QPen& pen = state->pen();
+
+    stream() << SVG_USE << SVG_HREF << SVG_SYMBOL_ID << symbolId << SVG_QUOTE
+             << SVG_X << SVG_QUOTE << p.x() + _dx << SVG_QUOTE
+             << SVG_Y << SVG_QUOTE << p.y() + _dy << SVG_QUOTE
+             << SVG_CLASS << getClass(_element) << SVG_QUOTE;
+
+    if (pen.style() == Qt::NoPen) {
+        stream() << SVG_FILL << SVG_NONE << SVG_QUOTE;
+    } else {
+        stream() << qbrushToSvg(pen.brush());
+    }
+
+    if (!qFuzzyIsNull(state->opacity() - 1)) {
+        stream() << SVG_OPACITY << state->opacity() << SVG_QUOTE;
+    }
+
+    stream() << _matrixString << SVG_ELEMENT_END << Qt::endl;
+}
+
+int SvgPaintEngine::defineSymbol(const QTextItem& textItem)
+{
+    const QString key = textItem.font().key() + QLatin1Char('\n') + textItem.text();
+
+    auto it = _symbolIds.constFind(key);
+    if (it != _symbolIds.cend()) {
+        return it.value();
+    }
+
+    QPainterPath path;
+    path.addText(0, 0, textItem.font(), textItem.text());
+    if (path.isEmpty()) {
+        _symbolIds.insert(key, 0);
+        return 0;
+    }
+
+    const int symbolId = ++_curSymbolId;
+    _symbolIds.insert(key, symbolId);
+
+    // The outline is written untranslated, <use> places it
+    const qreal dx = _dx;
+    const qreal dy = _dy;
+    _dx = 0;
+    _dy = 0;
+
+    stream() << SVG_DEFS_BEGIN << SVG_SPACE << SVG_PATH << SVG_ID << SVG_SYMBOL_ID << symbolId << SVG_QUOTE;
+    drawPathData(path);
+    stream() << SVG_ELEMENT_END << SVG_DEFS_END << Qt::endl;
+
+    _dx = dx;
+    _dy = dy;
+
+    return symbolId;
+}
+
 void SvgPaintEngine::drawPathData(const QPainterPath& p)
 {
     // Path data
@@ -89,6 +89,9 @@ public:
 
     void setReplaceClipPathWithMask(bool v);
 
+    //! NOTE Emit every distinct glyph run once inside <defs> and reference it with <use>
+    void setUseSymbolDefs(bool v);
+
 protected:
     QPaintEngine* paintEngine() const;
     int metric(QPaintDevice::PaintDeviceMetric metric) const;
@@ -22,7 +22,7 @@
 
 #include "svgwriter.h"
 
-#include <QBuffer>
+#include <QIODevice>
 
 #include "draw/painter.h"
 
@@ -44,6 +44,27 @@ using namespace mu::notation;
 using namespace muse;
 using namespace muse::io;
 
+namespace {
+//! NOTE Lets SvgGenerator stream straight into the destination device
+class DeviceStream : public QIODevice
+{
+public:
+    explicit DeviceStream(io::IODevice& device)
+        : m_device(device) {}
+
+protected:
+    qint64 readData(char*, qint64) override { return -1; }
+
+    qint64 writeData(const char* data, qint64 len) override
+    {
+        return static_cast<qint64>(m_device.write(reinterpret_cast<const uint8_t*>(data), static_cast<size_t>(len)));
+    }
+
+private:
+    io::IODevice& m_device;
+};
+}
+
 std::vector<INotationWriter::UnitType> SvgWriter::supportedUnitTypes() const
 {
     return { UnitType::PER_PAGE };
@@ -64,7 +85,6 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
 
     score->setPrinting(true); // don’t print page break symbols etc.
 
-    mu::engraving::MScore::pdfPrinting = true;
     mu::engraving::MScore::svgPrinting = true;
 
     const std::vector<mu::engraving::Page*>& pages = score->pages();
@@ -76,8 +96,7 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
 
     mu::engraving::Page* page = pages.at(PAGE_NUMBER);
 
-    QByteArray qdata;
-    QBuffer buf(&qdata);
+    DeviceStream buf(destinationDevice);
     buf.open(QIODevice::WriteOnly);
 
     SvgGenerator printer;
@@ -86,6 +105,7 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
     printer.setOutputDevice(&buf);
 
     printer.setReplaceClipPathWithMask(configuration()->exportSvgWithIllustratorCompat());
+    printer.setUseSymbolDefs(configuration()->exportSvgWithSymbolDefs());
 
     const int TRIM_MARGIN_SIZE = configuration()->trimMarginPixelSize();
 
@@ -263,13 +283,10 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
     }
 
     painter.endDraw();
-
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
+    buf.close();
 
     // Clean up and return
     score->setPrinting(false);
-    mu::engraving::MScore::pdfPrinting = false;
     mu::engraving::MScore::svgPrinting = false;
 
     return true;
@@ -0,0 +1,69 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QPageLayout>
+#include <QPageSize>
+#include <QPdfWriter>
+#include <QSizeF>
+#include <QString>
+
+#include "global/iapplication.h"
+
+#include "iimagesexportconfiguration.h"
+
+namespace mu::iex::imagesexport {
+//! NOTE The settings of the score PDF document. Taken on the calling thread,
+//! so that the document can be set up on another one (see BackendApi::schedulePdf)
+struct PdfWriterSettings {
+    QString title;
+    QString creator;
+    QSizeF pageSizeInch;
+    int dpi = 0;
+    bool grayscale = false;
+};
+
+inline PdfWriterSettings makePdfWriterSettings(const IImagesExportConfiguration& configuration, const muse::IApplication& application,
+                                               const QString& title, const QSizeF& pageSizeInch)
+{
+    PdfWriterSettings settings;
+    settings.title = title;
+    settings.creator = QString("MuseScore Studio Version: ") + application.version().toString().toQString();
+    settings.pageSizeInch = pageSizeInch;
+    settings.dpi = configuration.exportPdfDpiResolution();
+    settings.grayscale = configuration.exportPdfWithGrayscale();
+
+    return settings;
+}
+
+//! NOTE Shared by PdfWriter and the backend export, which writes recorded pages without the writer
+inline void preparePdfWriter(QPdfWriter& pdfWriter, const PdfWriterSettings& settings)
+{
+    pdfWriter.setResolution(settings.dpi);
+    pdfWriter.setCreator(settings.creator);
+    pdfWriter.setTitle(settings.title);
+    pdfWriter.setPageMargins(QMarginsF());
+    pdfWriter.setPageLayout(QPageLayout(QPageSize(settings.pageSizeInch, QPageSize::Inch), QPageLayout::Orientation::Portrait,
+                                        QMarginsF()));
+    pdfWriter.setColorModel(settings.grayscale ? QPdfWriter::ColorModel::Grayscale : QPdfWriter::ColorModel::Auto);
+}
+}
@@ -0,0 +1,187 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <QBuffer>
+#include <QFontDatabase>
+#include <QMap>
+#include <QPainter>
+#include <QRegularExpression>
+
+#include "importexport/imagesexport/internal/svggenerator.h"
+
+namespace mu::iex::imagesexport {
+class ImagesExport_SvgGeneratorTests : public ::testing::Test
+{
+public:
+    struct Glyph {
+        QRectF bbox;
+        QString fill;
+    };
+
+    static QFont testFont();
+    static QByteArray drawRepeatedText(const QFont& font, bool useSymbolDefs);
+    static std::vector<Glyph> drawnGlyphs(const QString& svg);
+};
+
+QFont ImagesExport_SvgGeneratorTests::testFont()
+{
+    static const int fontId = QFontDatabase::addApplicationFont(":/fonts/edwin/Edwin-Roman.otf");
+    EXPECT_NE(fontId, -1);
+
+    QFont font(QFontDatabase::applicationFontFamilies(fontId).value(0));
+    font.setPixelSize(20);
+    return font;
+}
+
+QByteArray ImagesExport_SvgGeneratorTests::drawRepeatedText(const QFont& font, bool useSymbolDefs)
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    SvgGenerator generator;
+    generator.setOutputDevice(&buffer);
+    generator.setSize(QSize(200, 100));
+    generator.setViewBox(QRectF(0, 0, 200, 100));
+    generator.setUseSymbolDefs(useSymbolDefs);
+
+    QPainter painter(&generator);
+    painter.setFont(font);
+
+    for (int i = 0; i < 3; ++i) {
+        painter.setPen(i == 1 ? Qt::red : Qt::black);
+        painter.drawText(QPointF(10 + 60 * i, 40), "Ab");
+        painter.drawText(QPointF(10 + 60 * i, 80), "c");
+    }
+
+    painter.end();
+
+    return buffer.data();
+}
+
+//! NOTE The bounding box and fill of every glyph run as it is drawn,
+//! with the <use> references resolved to their <defs> outline
+std::vector<ImagesExport_SvgGeneratorTests::Glyph> ImagesExport_SvgGeneratorTests::drawnGlyphs(const QString& svg)
+{
+    static const QRegularExpression DEF_RE(R"re(<defs> <path id="(s\d+)" d="([^"]*)"/></defs>)re");
+    static const QRegularExpression PATH_RE(R"re(<path ([^>]*?) d="([^"]*)")re");
+    static const QRegularExpression USE_RE(R"re(<use xlink:href="#(s\d+)" x="([^"]*)" y="([^"]*)"([^>]*)/>)re");
+    static const QRegularExpression FILL_RE(R"re( fill="([^"]*)")re");
+    static const QRegularExpression POINT_RE(R"re((-?[\d.]+(?:e-?\d+)?),(-?[\d.]+(?:e-?\d+)?))re");
+
+    //! NOTE Black is the default fill and is not written
+    auto fill = [](const QString& attributes) {
+        return FILL_RE.match(attributes).captured(1);
+    };
+
+    auto pathBox = [](const QString& d) {
+        QPointF topLeft(std::numeric_limits<qreal>::max(), std::numeric_limits<qreal>::max());
+        QPointF bottomRight(std::numeric_limits<qreal>::lowest(), std::numeric_limits<qreal>::lowest());
+
+        QRegularExpressionMatchIterator it = POINT_RE.globalMatch(d);
+        while (it.hasNext()) {
+            QRegularExpressionMatch m = it.next();
+            const qreal x = m.captured(1).toDouble();
+            const qreal y = m.captured(2).toDouble();
+            topLeft = QPointF(std::min(topLeft.x(), x), std::min(topLeft.y(), y));
+            bottomRight = QPointF(std::max(bottomRight.x(), x), std::max(bottomRight.y(), y));
+        }
+
+        return QRectF(topLeft, bottomRight);
+    };
+
+    QMap<QString, QRectF> defs;
+    QString rest = svg;
+    QRegularExpressionMatchIterator defIt = DEF_RE.globalMatch(svg);
+    while (defIt.hasNext()) {
+        QRegularExpressionMatch m = defIt.next();
+        defs.insert(m.captured(1), pathBox(m.captured(2)));
+        rest.replace(m.captured(0), QString());
+    }
+
+    std::vector<std::pair<qsizetype, Glyph> > glyphs;
+
+    QRegularExpressionMatchIterator pathIt = PATH_RE.globalMatch(rest);
+    while (pathIt.hasNext()) {
+        QRegularExpressionMatch m = pathIt.next();
+        glyphs.push_back({ m.capturedStart(), { pathBox(m.captured(2)), fill(m.captured(1)) } });
+    }
+
+    QRegularExpressionMatchIterator useIt = USE_RE.globalMatch(rest);
+    while (useIt.hasNext()) {
+        QRegularExpressionMatch m = useIt.next();
+        const QRectF box = defs.value(m.captured(1)).translated(m.captured(2).toDouble(), m.captured(3).toDouble());
+        glyphs.push_back({ m.capturedStart(), { box, fill(m.captured(4)) } });
+    }
+
+    std::sort(glyphs.begin(), glyphs.end(), [](const auto& g1, const auto& g2) {
+        return g1.first < g2.first;
+    });
+
+    std::vector<Glyph> result;
+    for (const auto& glyph : glyphs) {
+        result.push_back(glyph.second);
+    }
+    return result;
+}
+
+TEST_F(ImagesExport_SvgGeneratorTests, SymbolDefs)
+{
+    // [GIVEN] The same two glyph runs drawn three times each, in different colors
+    const QFont font = testFont();
+
+    // [WHEN] Write them inline and with symbol defs
+    const QString inlineSvg = QString::fromUtf8(drawRepeatedText(font, false));
+    const QString defsSvg = QString::fromUtf8(drawRepeatedText(font, true));
+
+    // [THEN] Inline, every run is a path of its own
+    EXPECT_EQ(inlineSvg.count("<defs>"), 0);
+    EXPECT_EQ(inlineSvg.count("<use"), 0);
+
+    // [THEN] With symbol defs, every distinct run is defined once and referenced every time it is drawn
+    EXPECT_EQ(defsSvg.count("<defs>"), 2);
+    EXPECT_EQ(defsSvg.count("<use"), 6);
+
+    // [THEN] Both draw the same outlines at the same places, with the same colors
+    const std::vector<Glyph> inlineGlyphs = drawnGlyphs(inlineSvg);
+    const std::vector<Glyph> defsGlyphs = drawnGlyphs(defsSvg);
+
+    ASSERT_EQ(inlineGlyphs.size(), 6u);
+    ASSERT_EQ(defsGlyphs.size(), inlineGlyphs.size());
+
+    for (size_t i = 0; i < inlineGlyphs.size(); ++i) {
+        const QRectF& expected = inlineGlyphs.at(i).bbox;
+        const QRectF& actual = defsGlyphs.at(i).bbox;
+
+        EXPECT_FALSE(expected.isEmpty());
+        EXPECT_NEAR(actual.left(), expected.left(), 0.05);
+        EXPECT_NEAR(actual.top(), expected.top(), 0.05);
+        EXPECT_NEAR(actual.right(), expected.right(), 0.05);
+        EXPECT_NEAR(actual.bottom(), expected.bottom(), 0.05);
+        EXPECT_EQ(defsGlyphs.at(i).fill, inlineGlyphs.at(i).fill);
+    }
+}
+}
@@ -236,6 +236,60 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
 
     writeHeader(context);
 
+    //! NOTE Every event goes only to the track of the staff it comes from (or restrikes a note in it),
+    //! so the rendered events are distributed to the tracks in one pass instead of scanning all of them
+    //! for every channel of every track. The order of the events of each track is kept
+    std::vector<staff_idx_t> equivalentStaves(tracks.size());
+    std::vector<std::vector<const std::pair<const int, NPlayEvent>*> > staffEvents(tracks.size());
+    {
+        std::vector<std::vector<staff_idx_t> > stavesByOrigin(m_score->masterScore()->nstaves());
+        for (staff_idx_t i = 0; i < tracks.size(); ++i) {
+            staff_idx_t equivalentStaffIdx = i;
+            for (Staff* st : m_score->masterScore()->staves()) {
+                if (m_score->staff(i)->id() == st->id()) {
+                    equivalentStaffIdx = st->idx();
+                }
+            }
+
+            if (equivalentStaffIdx >= stavesByOrigin.size()) {
+                stavesByOrigin.resize(equivalentStaffIdx + 1);
+            }
+            stavesByOrigin[equivalentStaffIdx].push_back(i);
+            equivalentStaves[i] = equivalentStaffIdx;
+        }
+
+        for (size_t e = 0; e < events.size(); ++e) {
+            for (const auto& item : events[e]) {
+                const NPlayEvent& event = item.second;
+                if (event.isMuted()) {
+                    continue;
+                }
+
+                staff_idx_t restrikeStaffIdx = muse::nidx;
+                if (event.discard() > 0 && event.velo() > 0 && event.discard() <= tracks.size()) {
+                    restrikeStaffIdx = event.discard() - 1;
+                    staffEvents[restrikeStaffIdx].push_back(&item);
+                }
+
+                if (event.getOriginatingStaff() >= stavesByOrigin.size()) {
+                    continue;
+                }
+
+                for (staff_idx_t i : stavesByOrigin[event.getOriginatingStaff()]) {
+                    if (i != restrikeStaffIdx) {
+                        staffEvents[i].push_back(&item);
+                    }
+                }
+            }
+        }
+    }
+
+    //! NOTE Every track chunk is written as soon as the track is complete and its events are released,
+    //! so only one track is held as MIDI events at a time
+    if (m_midiFile.beginWrite(device, static_cast<int>(tracks.size()))) {
+        return false;
+    }
+
     staff_idx_t staffIdx = 0;
     for (auto& track: tracks) {
         Staff* staff = m_score->staff(staffIdx);
@@ -294,66 +348,54 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
                     track.insert(0, ev);
                 }
 
-                for (size_t e = 0; e < events.size(); ++e) {
-                    auto& multimap = events[e];
-                    for (auto& item : multimap) {
-                        const NPlayEvent& event = item.second;
-                        if (event.isMuted()) {
-                            continue;
-                        }
-                        if (event.discard() == staffIdx + 1 && event.velo() > 0) {
-                            // turn note off so we can restrike it in another track
-                            track.insert(CompatMidiRender::tick(context, item.first), MidiEvent(ME_NOTEON, channel,
-                                                                                                event.pitch(), 0));
-                        }
-
-                        staff_idx_t equivalentStaffIdx = staffIdx;
-                        for (Staff* st : m_score->masterScore()->staves()) {
-                            if (staff->id() == st->id()) {
-                                equivalentStaffIdx = st->idx();
-                            }
-                        }
+                for (const auto* itemPtr : staffEvents[staffIdx]) {
+                    const auto& item = *itemPtr;
+                    const NPlayEvent& event = item.second;
+                    if (event.discard() == staffIdx + 1 && event.velo() > 0) {
+                        // turn note off so we can restrike it in another track
+                        track.insert(CompatMidiRender::tick(context, item.first), MidiEvent(ME_NOTEON, channel,
+                                                                                            event.pitch(), 0));
+                    }
 
-                        if (event.getOriginatingStaff() != equivalentStaffIdx) {
-                            continue;
-                        }
+                    if (event.getOriginatingStaff() != equivalentStaves[staffIdx]) {
+                        continue;
+                    }
 
-                        if (event.discard() && event.velo() == 0) {
-                            // ignore noteoff but restrike noteon
-                            continue;
-                        }
+                    if (event.discard() && event.velo() == 0) {
+                        // ignore noteoff but restrike noteon
+                        continue;
+                    }
 
-                        if (!exportRPNs && event.type() == ME_CONTROLLER && event.portamento()) {
-                            // ignore portamento control events if exportRPN isn't switched on
-                            continue;
-                        }
+                    if (!exportRPNs && event.type() == ME_CONTROLLER && event.portamento()) {
+                        // ignore portamento control events if exportRPN isn't switched on
+                        continue;
+                    }
 
-                        char eventPort    = m_score->masterScore()->midiPort(event.channel());
-                        char eventChannel = m_score->masterScore()->midiChannel(event.channel());
-                        if (port != eventPort || channel != eventChannel) {
-                            continue;
-                        }
+                    char eventPort    = m_score->masterScore()->midiPort(event.channel());
+                    char eventChannel = m_score->masterScore()->midiChannel(event.channel());
+                    if (port != eventPort || channel != eventChannel) {
+                        continue;
+                    }
 
-                        if (event.type() == ME_NOTEON) {
-                            // use the note values instead of the event values if portamento is suppressed
-                            if (!exportRPNs && event.portamento()) {
-                                track.insert(CompatMidiRender::tick(context, item.first), MidiEvent(ME_NOTEON, channel,
-                                                                                                    event.note()->pitch(),
-                                                                                                    event.velo()));
-                            } else {
-                                track.insert(CompatMidiRender::tick(context, item.first), MidiEvent(ME_NOTEON, channel,
-                                                                                                    event.pitch(), event.velo()));
-                            }
-                        } else if (event.type() == ME_CONTROLLER) {
-                            track.insert(CompatMidiRender::tick(context, item.first), MidiEvent(ME_CONTROLLER, channel,
-                                                                                                event.controller(),
-                                                                                                event.value()));
-                        } else if (event.type() == ME_PITCHBEND) {
-                            track.insert(CompatMidiRender::tick(context, item.first), MidiEvent(ME_PITCHBEND, channel,
-                                                                                                event.dataA(), event.dataB()));
+                    if (event.type() == ME_NOTEON) {
+                        // use the note values instead of the event values if portamento is suppressed
+                        if (!exportRPNs && event.portamento()) {
+                            track.insert(CompatMidiRender::tick(context, item.first), MidiEvent(ME_NOTEON, channel,
+                                                                                                event.note()->pitch(),
+                                                                                                event.velo()));
                         } else {
-                            LOGD("writeMidi: unknown midi event 0x%02x", event.type());
+                            track.insert(CompatMidiRender::tick(context, item.first), MidiEvent(ME_NOTEON, channel,
+                                                                                                event.pitch(), event.velo()));
                         }
+                    } else if (event.type() == ME_CONTROLLER) {
+                        track.insert(CompatMidiRender::tick(context, item.first), MidiEvent(ME_CONTROLLER, channel,
+                                                                                            event.controller(),
+                                                                                            event.value()));
+                    } else if (event.type() == ME_PITCHBEND) {
+                        track.insert(CompatMidiRender::tick(context, item.first), MidiEvent(ME_PITCHBEND, channel,
+                                                                                            event.dataA(), event.dataB()));
+                    } else {
+                        LOGD("writeMidi: unknown midi event 0x%02x", event.type());
                     }
                 }
             }
@@ -419,9 +461,16 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
                 }
             }
         }
+
+        if (m_midiFile.writeTrack(track)) {
+            return false;
+        }
+        track.events().clear();
+        staffEvents[staffIdx] = {};
+
         ++staffIdx;
     }
-    return !m_midiFile.write(device);
+    return true;
 }
 
 bool ExportMidi::write(const QString& name, bool midiExpandRepeats, bool exportRPNs, const SynthesizerState& synthState)
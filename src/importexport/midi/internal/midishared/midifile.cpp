@@ -22,6 +22,8 @@
 
 #include "midifile.h"
 
+#include <QBuffer>
+
 #include "containers.h"
 
 #include "log.h"
@@ -50,12 +52,9 @@ MidiFile::MidiFile()
 
 bool MidiFile::write(QIODevice* out)
 {
-    fp = out;
-    write("MThd", 4);
-    writeLong(6);                   // header len
-    writeShort(_format);            // format
-    writeShort(static_cast<int>(_tracks.size()));
-    writeShort(_division);
+    if (beginWrite(out, static_cast<int>(_tracks.size()))) {
+        return true;
+    }
     for (const auto& t: _tracks) {
         if (writeTrack(t)) {
             return true;
@@ -64,6 +63,25 @@ bool MidiFile::write(QIODevice* out)
     return false;
 }
 
+//---------------------------------------------------------
+//   beginWrite
+//    writes the header chunk, the tracks follow with writeTrack()
+//    returns true on error
+//---------------------------------------------------------
+
+bool MidiFile::beginWrite(QIODevice* out, int trackCount)
+{
+    fp = out;
+    if (write("MThd", 4)) {
+        return true;
+    }
+    writeLong(6);                   // header len
+    writeShort(_format);            // format
+    writeShort(trackCount);
+    writeShort(_division);
+    return false;
+}
+
 //---------------------------------------------------------
 //   write
 //---------------------------------------------------------
@@ -137,9 +155,14 @@ void MidiFile::writeEvent(const MidiEvent& event)
 
 bool MidiFile::writeTrack(const MidiTrack& t)
 {
-    write("MTrk", 4);
-    qint64 lenpos = fp->pos();
-    writeLong(0);                   // dummy len
+    //! NOTE The track chunk is assembled in memory and written in one go,
+    //! so the output isn't written byte by byte and doesn't need to be seekable
+    QByteArray chunk;
+    QBuffer chunkBuffer(&chunk);
+    chunkBuffer.open(QIODevice::WriteOnly);
+
+    QIODevice* out = fp;
+    fp = &chunkBuffer;
 
     status   = -1;
     int tick = 0;
@@ -165,11 +188,13 @@ bool MidiFile::writeTrack(const MidiTrack& t)
     put(0xff);          // Meta
     put(0x2f);          // EOT
     putvl(0);           // len 0
-    qint64 endpos = fp->pos();
-    fp->seek(lenpos);
-    writeLong(endpos - lenpos - 4); // tracklen
-    fp->seek(endpos);
-    return false;
+
+    fp = out;
+    if (write("MTrk", 4)) {
+        return true;
+    }
+    writeLong(static_cast<int>(chunk.size())); // tracklen
+    return write(chunk.constData(), chunk.size());
 }
 
 //---------------------------------------------------------
@@ -79,7 +79,6 @@ protected:
     bool write(const void*, qint64);
     void writeShort(int);
     void writeLong(int);
-    bool writeTrack(const MidiTrack&);
     void putvl(unsigned);
     void put(unsigned char c) { write(&c, 1); }
     void writeStatus(int type, int channel);
@@ -99,6 +98,10 @@ public:
     bool read(QIODevice*);
     bool write(QIODevice*);
 
+    // incremental write: the header, then every track as soon as it is complete
+    bool beginWrite(QIODevice*, int trackCount);
+    bool writeTrack(const MidiTrack&);
+
     std::vector<MidiTrack>& tracks() { return _tracks; }
     const std::vector<MidiTrack>& tracks() const { return _tracks; }
 
@@ -2688,7 +2688,7 @@ static void addGraceChordsBefore(Chord* c, GraceChordList& gcl)
 
 static bool canAddTempoText(const TempoMap* const tempoMap, const int tick)
 {
-    if (!muse::contains(*tempoMap, tick)) {
+    if (!tempoMap->contains(tick)) {
         return true;
     }
 
@@ -556,7 +556,6 @@ bool VideoWriter::generateScoreFrames(muse::media::IVideoEncoderPtr encoder, INo
     }
 
     PageList pages = notation->elements()->pages();
-    auto painting = notation->painting();
     INotationPlaybackPtr playback = notation->masterNotation()->playback();
     muse::RectF frameRect = muse::RectF::fromQRectF(QRectF(frame.rect()));
 
@@ -569,6 +568,17 @@ bool VideoWriter::generateScoreFrames(muse::media::IVideoEncoderPtr encoder, INo
         return nullptr;
     };
 
+    //! NOTE Each page is painted for many frames, so it's recorded once and then replayed.
+    //! Only the pages the playback goes through are recorded
+    const Page* firstPage = pageByTick(pages, playback->secToTick(0.0f));
+    const Page* lastPage = pageByTick(pages, playback->secToTick(totalPlayTimeSec));
+    auto painting = notation->painting();
+    painting->recordPageDisplayLists(firstPage ? static_cast<int>(firstPage->pageNumber()) : 0,
+                                     lastPage ? static_cast<int>(lastPage->pageNumber()) : -1);
+    DEFER {
+        painting->clearPageDisplayLists();
+    };
+
     const Color CURSOR_COLOR = Color(2, 109, 203, 127);
 
     PlaybackCursor cursor(iocContext());
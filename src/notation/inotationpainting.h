@@ -23,10 +23,12 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "notationtypes.h"
 
 #include "draw/painter.h"
+#include "draw/types/drawdata.h"
 #include "engraving/rendering/iscorerenderer.h"
 
 namespace mu::notation {
@@ -49,6 +51,42 @@ public:
     virtual void paintPdf(muse::draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(muse::draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(muse::draw::Painter* painter, const Options& opt) = 0;
+
+    //! NOTE Draw commands of the pages, recorded by recordPageDisplayLists.
+    //! Refers to no score objects, so it can be replayed without the score, on any thread
+    struct PageDisplayLists {
+        //! NOTE The items of one system (or the page items outside of systems) in paint order,
+        //! with the bounding box of the items (in page coordinates)
+        struct Chunk {
+            muse::RectF bbox;
+            muse::draw::DrawDataPtr drawData;
+        };
+
+        struct Page {
+            bool isRecorded = false;
+            muse::RectF rect;
+            muse::RectF trimmedRect;
+            std::vector<Chunk> chunks;
+        };
+
+        muse::SizeF pageSizeInch;
+        std::vector<Page> pages;
+    };
+    using PageDisplayListsPtr = std::shared_ptr<const PageDisplayLists>;
+
+    //! NOTE Records the draw commands of the given pages once (toPage -1 means the last page).
+    //! Until the score changes, paintPdf, paintPrint and paintPng replay them instead of
+    //! painting the score items again. Only the systems that intersect the painted tile are replayed
+    virtual void recordPageDisplayLists(int fromPage, int toPage) = 0;
+    virtual void clearPageDisplayLists() = 0;
+
+    //! NOTE The recorded pages, if they match the current layout, otherwise nullptr
+    virtual PageDisplayListsPtr pageDisplayLists() const = 0;
+
+    //! NOTE Paints the given recorded pages as paintPdf paints the score,
+    //! returns false if they can't be painted with these options.
+    //! Reads neither the score nor this object, so it can be called on any thread
+    virtual bool paintRecordedPdf(muse::draw::Painter* painter, const Options& opt, const PageDisplayListsPtr& recordedPages) const = 0;
 };
 
 using INotationPaintingPtr = std::shared_ptr<INotationPainting>;
@@ -62,6 +62,7 @@ public:
     virtual const muse::TranslatableString topMostRedoActionName() const = 0;
     virtual size_t undoRedoActionCount() const = 0;
     virtual size_t currentStateIndex() const = 0;
+    virtual size_t firstStateIndex() const = 0;
     virtual const muse::TranslatableString lastActionNameAtIdx(size_t) const = 0;
 
     virtual muse::async::Notification stackChanged() const = 0;
@@ -40,6 +40,7 @@
 #include "engraving/dom/keysig.h"
 #include "engraving/dom/sig.h"
 #include "engraving/dom/tempotext.h"
+#include "engraving/editing/transaction/undostack.h"
 
 #include "excerptnotation.h"
 #include "masternotationparts.h"
@@ -58,6 +59,10 @@ using namespace mu::engraving;
 using namespace muse;
 using namespace muse::async;
 
+static constexpr int CLOSED_PARTS_LAYOUT_IDLE_INTERVAL = 1000; // ms
+static constexpr int CLOSED_PARTS_LAYOUT_STEP_INTERVAL = 50; // ms
+static constexpr int CLOSED_PARTS_LAYOUT_STEP_MEASURES = 8;
+
 static ExcerptNotation* get_impl(const IExcerptNotationPtr& excerpt)
 {
     return static_cast<ExcerptNotation*>(excerpt.get());
@@ -102,6 +107,9 @@ MasterNotation::MasterNotation(project::INotationProject* project, const muse::m
     partList.onItemRemoved(this, [this](const Part*) {
         onPartsChanged();
     });
+
+    m_closedPartsLayoutTimer.setSingleShot(true);
+    QObject::connect(&m_closedPartsLayoutTimer, &QTimer::timeout, [this]() { layoutNextClosedPart(); });
 }
 
 MasterNotation::~MasterNotation()
@@ -142,6 +150,8 @@ void MasterNotation::initAfterSettingScore(const MasterScore* score, bool disabl
         if (!changes.isTextEditing) {
             updateExcerpts();
         }
+
+        scheduleClosedPartsLayout();
     });
 
     if (!disablePlayback) {
@@ -149,6 +159,45 @@ void MasterNotation::initAfterSettingScore(const MasterScore* score, bool disabl
     }
 
     initExcerptNotations(score->excerpts());
+
+    scheduleClosedPartsLayout();
+}
+
+//! NOTE The ranges edited in closed parts are laid out while the user is idle,
+//! a few measures of one part per step, so that no step blocks the UI for long.
+//! A part that needs a full layout is skipped here and laid out when it is opened or exported.
+//! Any new edit restarts the idle interval, which cancels the remaining steps.
+void MasterNotation::scheduleClosedPartsLayout()
+{
+    m_closedPartsLayoutTimer.start(CLOSED_PARTS_LAYOUT_IDLE_INTERVAL);
+}
+
+void MasterNotation::layoutNextClosedPart()
+{
+    const mu::engraving::MasterScore* master = masterScore();
+    if (!master) {
+        return;
+    }
+
+    if (master->undoStack()->hasActiveTransaction()) {
+        scheduleClosedPartsLayout();
+        return;
+    }
+
+    for (const IExcerptNotationPtr& excerpt : m_excerpts) {
+        const INotationPtr notation = excerpt->notation();
+        if (!notation || notation->isOpen()) {
+            continue;
+        }
+
+        mu::engraving::Score* score = notation->elements()->msScore();
+        if (!score || !score->doPendingLayoutStep(CLOSED_PARTS_LAYOUT_STEP_MEASURES)) {
+            continue;
+        }
+
+        m_closedPartsLayoutTimer.start(CLOSED_PARTS_LAYOUT_STEP_INTERVAL);
+        return;
+    }
 }
 
 void MasterNotation::setMasterScore(mu::engraving::MasterScore* score, bool disablePlayback)
@@ -591,7 +640,7 @@ void MasterNotation::setExcerptIsOpen(const INotationPtr excerptNotation, bool o
     excerptNotation->setIsOpen(open);
 
     if (open) {
-        excerptNotation->elements()->msScore()->doLayout();
+        excerptNotation->elements()->msScore()->doPendingLayout();
     }
 }
 
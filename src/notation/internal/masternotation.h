@@ -23,6 +23,8 @@
 
 #include <memory>
 
+#include <QTimer>
+
 #include "async/notification.h"
 
 #include "notation.h"
@@ -84,6 +86,8 @@ private:
     void addExcerptsToMasterScore(const std::vector<engraving::Excerpt*>& excerpts);
     void doSetExcerpts(const ExcerptNotationList& excerpts);
     void updateExcerpts();
+    void scheduleClosedPartsLayout();
+    void layoutNextClosedPart();
     void updatePotentialExcerpts() const;
     void unloadExcerpts(ExcerptNotationList& excerpts);
 
@@ -110,6 +114,8 @@ private:
     // we need to regenerate potential excerpts, even though for all part IDs a
     // potential excerpt already exists.
     mutable bool m_potentialExcerptsForcedDirty = false;
+
+    QTimer m_closedPartsLayoutTimer;
 };
 
 using MasterNotationPtr = std::shared_ptr<MasterNotation>;
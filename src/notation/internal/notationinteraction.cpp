@@ -630,12 +630,29 @@ void NotationInteraction::toggleVisible()
 
 EngravingItem* NotationInteraction::hitElement(const PointF& pos, float width) const
 {
-    std::vector<mu::engraving::EngravingItem*> elements = hitElements(pos, width);
-    if (elements.empty()) {
+    // Called on every mouse move, so avoid allocating: collect into reusable buffers.
+    // The hits are sorted the same way as in hitElements(), elementIsLess isn't a strict
+    // weak ordering for all element types, so a linear max may pick a different element
+    std::vector<EngravingItem*>& elements = m_hitElementsBuffer;
+    if (!collectHitElements(pos, width, elements)) {
         return nullptr;
     }
-    m_selection->onElementHit(elements.back());
-    return elements.back();
+
+    EngravingItem* topmost = nullptr;
+    if (!elements.empty()) {
+        std::sort(elements.begin(), elements.end(), NotationInteraction::elementIsLess);
+        topmost = elements.back();
+    } else {
+        topmost = hitMeasure(pos).measure;
+    }
+
+    elements.clear();
+
+    if (!topmost) {
+        return nullptr;
+    }
+    m_selection->onElementHit(topmost);
+    return topmost;
 }
 
 Staff* NotationInteraction::hitStaff(const PointF& pos) const
@@ -688,12 +705,31 @@ EngravingItem* NotationInteraction::elementAt(const PointF& p) const
 
 std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos, float width) const
 {
-    mu::engraving::Page* page = point2page(pos);
-    if (!page) {
+    std::vector<EngravingItem*> hitElements;
+    if (!collectHitElements(pos, width, hitElements)) {
         return {};
     }
 
-    std::vector<EngravingItem*> hitElements;
+    if (!hitElements.empty()) {
+        std::sort(hitElements.begin(), hitElements.end(), NotationInteraction::elementIsLess);
+    } else {
+        Measure* measure = hitMeasure(pos).measure;
+        if (measure) {
+            hitElements.push_back(measure);
+        }
+    }
+
+    return hitElements;
+}
+
+bool NotationInteraction::collectHitElements(const PointF& pos, float width, std::vector<EngravingItem*>& hitElements) const
+{
+    hitElements.clear();
+
+    mu::engraving::Page* page = point2page(pos);
+    if (!page) {
+        return false;
+    }
 
     PointF posOnPage = pos - page->pos();
 
@@ -702,13 +738,14 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
         RectF editHitRect(posOnPage.x() - editW, posOnPage.y() - editW, 2.0 * editW, 2.0 * editW);
         if (m_editData.element->intersects(editHitRect)) {
             hitElements.push_back(m_editData.element);
-            return hitElements;
+            return true;
         }
     }
 
     RectF hitRect(posOnPage.x() - width, posOnPage.y() - width, 3.0 * width, 3.0 * width);
 
-    std::vector<EngravingItem*> potentiallyHitElements = page->items(hitRect);
+    std::vector<EngravingItem*>& potentiallyHitElements = m_hitCandidatesBuffer;
+    page->items(hitRect, potentiallyHitElements);
 
     auto canHitElement = [](const EngravingItem* element) {
         if (!element->selectable() || element->isPage()) {
@@ -751,16 +788,9 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
         }
     }
 
-    if (!hitElements.empty()) {
-        std::sort(hitElements.begin(), hitElements.end(), NotationInteraction::elementIsLess);
-    } else {
-        Measure* measure = hitMeasure(pos).measure;
-        if (measure) {
-            hitElements.push_back(measure);
-        }
-    }
+    potentiallyHitElements.clear();
 
-    return hitElements;
+    return true;
 }
 
 NotationInteraction::HitMeasureData NotationInteraction::hitMeasure(const PointF& pos) const
@@ -425,6 +425,9 @@ private:
     std::vector<EngravingItem*> elementsAt(const muse::PointF& p) const;
     EngravingItem* elementAt(const muse::PointF& p) const;
 
+    // Fills hitElements (unsorted) with the elements hit at pos; returns false if pos is not on a page
+    bool collectHitElements(const muse::PointF& pos, float width, std::vector<EngravingItem*>& hitElements) const;
+
     // Sorting using this function will place the elements that are the most
     // interesting to be selected at the end of the list
     static bool elementIsLess(const mu::engraving::EngravingItem* e1, const mu::engraving::EngravingItem* e2);
@@ -578,6 +581,10 @@ private:
     bool m_notifyAboutDropChanged = false;
     HitElementContext m_hitElementContext;
 
+    // Reused between hit tests to avoid allocating on every mouse move
+    mutable std::vector<EngravingItem*> m_hitCandidatesBuffer;
+    mutable std::vector<EngravingItem*> m_hitElementsBuffer;
+
     muse::async::Channel<ShowItemRequest> m_showItemRequested;
 
     QTimer m_textCursorBlinkTimer;
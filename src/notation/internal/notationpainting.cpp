@@ -21,9 +21,18 @@
  */
 #include "notationpainting.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include <QScreen>
 
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+
+#include "engraving/dom/page.h"
 #include "engraving/dom/score.h"
+#include "engraving/dom/system.h"
+#include "engraving/editing/transaction/undostack.h"
 
 #include "notation.h"
 #include "notationinteraction.h"
@@ -214,6 +223,9 @@ void NotationPainting::paintPdf(Painter* painter, const Options& opt)
     myopt.isSetViewport = true;
     myopt.isMultiPage = false;
     myopt.isPrinting = true;
+    if (replayPageDisplayLists(painter, myopt)) {
+        return;
+    }
     doPaint(painter, myopt);
 }
 
@@ -224,6 +236,9 @@ void NotationPainting::paintPrint(Painter* painter, const Options& opt)
     myopt.isSetViewport = true;
     myopt.isMultiPage = false;
     myopt.isPrinting = true;
+    if (replayPageDisplayLists(painter, myopt)) {
+        return;
+    }
     doPaint(painter, myopt);
 }
 
@@ -234,5 +249,256 @@ void NotationPainting::paintPng(Painter* painter, const Options& opt)
     myopt.isSetViewport = true;
     myopt.isMultiPage = false;
     myopt.isPrinting = true;
+    if (replayPageDisplayLists(painter, myopt)) {
+        return;
+    }
     doPaint(painter, myopt);
 }
+
+//! NOTE Every page is recorded in its own coordinates, without viewport, trimming and background,
+//! so the same recording serves any device resolution and any part of the page.
+//! The items are painted in the same order as Paint::paintScore does, but grouped by system,
+//! so that a replay can skip the systems outside of the painted tile.
+//! Items of different systems don't overlap, so painting them system by system looks the same
+void NotationPainting::recordPageDisplayLists(int fromPage, int toPage)
+{
+    TRACEFUNC;
+
+    Score* s = score();
+    if (!s) {
+        return;
+    }
+
+    const std::vector<Page*>& pages = s->pages();
+    if (pages.empty()) {
+        clearPageDisplayLists();
+        return;
+    }
+
+    fromPage = std::max(fromPage, 0);
+    toPage = (toPage >= 0 && toPage < int(pages.size())) ? toPage : (int(pages.size()) - 1);
+
+    std::shared_ptr<PageDisplayLists> displayLists = std::make_shared<PageDisplayLists>();
+    displayLists->pageSizeInch = scoreRenderer()->pageSizeInch(s);
+    displayLists->pages.resize(pages.size());
+
+    const bool wasPrinting = s->printing();
+    s->setPrinting(true);
+
+    engraving::rendering::PaintOptions paintOpt;
+    paintOpt.isPrinting = true;
+
+    for (int pi = fromPage; pi <= toPage; ++pi) {
+        const Page* page = pages.at(pi);
+
+        PageDisplayLists::Page& recordedPage = displayLists->pages.at(pi);
+        recordedPage.isRecorded = true;
+        recordedPage.rect = page->ldata()->bbox();
+        recordedPage.trimmedRect = page->tbbox();
+
+        std::vector<EngravingItem*> items = page->items(recordedPage.rect);
+        std::sort(items.begin(), items.end(), engraving::elementLessThan);
+
+        //! NOTE The first group holds the items outside of systems (e.g. header and footer)
+        const std::vector<System*>& systems = page->systems();
+        std::vector<std::vector<const EngravingItem*> > groups(systems.size() + 1);
+
+        for (const EngravingItem* item : items) {
+            if (!item->isInteractionAvailable()) {
+                continue;
+            }
+
+            const EngravingItem* system = item->isSystem() ? item : item->findAncestor(ElementType::SYSTEM);
+            auto it = system ? std::find(systems.cbegin(), systems.cend(), system) : systems.cend();
+            const size_t group = it != systems.cend() ? static_cast<size_t>(std::distance(systems.cbegin(), it)) + 1 : 0;
+
+            groups.at(group).push_back(item);
+        }
+
+        for (const std::vector<const EngravingItem*>& group : groups) {
+            if (group.empty()) {
+                continue;
+            }
+
+            std::shared_ptr<BufferedPaintProvider> provider = std::make_shared<BufferedPaintProvider>();
+            RectF bbox;
+
+            {
+                Painter painter(provider, "displaylist");
+                painter.setAntialiasing(true);
+
+                for (const EngravingItem* item : group) {
+                    scoreRenderer()->paintItem(painter, item, paintOpt);
+                    bbox.unite(item->pageBoundingRect());
+                }
+
+                painter.endDraw();
+            }
+
+            if (!bbox.isNull()) {
+                recordedPage.chunks.push_back({ bbox, provider->drawData() });
+            }
+        }
+    }
+
+    s->setPrinting(wasPrinting);
+
+    m_pageDisplayLists = displayLists;
+    m_recordedRevision = currentRevision();
+}
+
+void NotationPainting::clearPageDisplayLists()
+{
+    m_pageDisplayLists = nullptr;
+    m_recordedRevision = RecordedRevision();
+}
+
+//! NOTE The recorded pages are valid while the score has not changed since, whatever the notifications.
+//! The view mode and the page count cover the relayouts that are not made by the undoable commands
+NotationPainting::RecordedRevision NotationPainting::currentRevision() const
+{
+    RecordedRevision revision;
+
+    const Score* s = score();
+    if (!s) {
+        return revision;
+    }
+
+    revision.scoreRevision = s->changesRevision();
+    revision.unattributedRevision = s->undoStack()->unattributedChangesRevision();
+    revision.viewMode = s->layoutMode();
+    revision.pageCount = s->pages().size();
+
+    return revision;
+}
+
+INotationPainting::PageDisplayListsPtr NotationPainting::pageDisplayLists() const
+{
+    if (!m_pageDisplayLists || !(m_recordedRevision == currentRevision())) {
+        return nullptr;
+    }
+
+    return m_pageDisplayLists;
+}
+
+bool NotationPainting::paintRecordedPdf(Painter* painter, const Options& opt, const PageDisplayListsPtr& recordedPages) const
+{
+    IF_ASSERT_FAILED(recordedPages) {
+        return false;
+    }
+
+    Options myopt = opt;
+    myopt.isSetViewport = true;
+    myopt.isMultiPage = false;
+    myopt.isPrinting = true;
+
+    return replay(painter, myopt, *recordedPages);
+}
+
+bool NotationPainting::replayPageDisplayLists(Painter* painter, const Options& opt) const
+{
+    const PageDisplayListsPtr recordedPages = pageDisplayLists();
+    if (!recordedPages) {
+        return false;
+    }
+
+    return replay(painter, opt, *recordedPages);
+}
+
+//! NOTE Reproduces what Paint::paintScore does for printed pages, but draws the recorded pages
+//! instead of the items. The offsets that paintScore applies as painter translations
+//! (the current translation, trimmed margins, tile) are moved into the window,
+//! because the recorded states carry their own world transforms.
+//! Uses only the recorded pages, not the score
+bool NotationPainting::replay(Painter* painter, const Options& opt, const PageDisplayLists& recordedPages)
+{
+    if (opt.overrideItemColor || opt.invertColors || opt.frameRect.isValid() || opt.onPaintPageSheet) {
+        return false;
+    }
+
+    const auto& worldTransform = painter->worldTransform();
+    if (worldTransform.m11() != 1.0 || worldTransform.m12() != 0.0 || worldTransform.m21() != 0.0 || worldTransform.m22() != 1.0) {
+        return false;
+    }
+
+    const std::vector<PageDisplayLists::Page>& pages = recordedPages.pages;
+    if (pages.empty()) {
+        return false;
+    }
+
+    const int fromPage = opt.fromPage >= 0 ? opt.fromPage : 0;
+    const int toPage = (opt.toPage >= 0 && opt.toPage < int(pages.size())) ? opt.toPage : (int(pages.size()) - 1);
+
+    for (int pi = fromPage; pi <= toPage; ++pi) {
+        if (!pages.at(pi).isRecorded) {
+            return false;
+        }
+    }
+
+    TRACEFUNC;
+
+    const int DEVICE_DPI = opt.deviceDpi > 0 ? opt.deviceDpi : engraving::DPI;
+    const SizeF& pageSize = recordedPages.pageSizeInch;
+    const RectF viewport(0.0, 0.0, std::lrint(pageSize.width() * DEVICE_DPI), std::lrint(pageSize.height() * DEVICE_DPI));
+    const RectF window(0.0, 0.0, std::lrint(pageSize.width() * engraving::DPI), std::lrint(pageSize.height() * engraving::DPI));
+    const PointF translation(worldTransform.dx(), worldTransform.dy());
+    const RectF tileRect = opt.tileRectInWindow(viewport, window);
+
+    painter->setAntialiasing(true);
+
+    for (int copy = 0; copy < opt.copyCount; ++copy) {
+        for (int pi = fromPage; pi <= toPage; ++pi) {
+            const PageDisplayLists::Page& page = pages.at(pi);
+
+            RectF pageRect = page.rect;
+            PointF origin = -translation;
+
+            if (opt.trimMarginPixelSize >= 0) {
+                double trimMargin = static_cast<double>(opt.trimMarginPixelSize);
+                pageRect = page.trimmedRect.adjusted(-trimMargin, -trimMargin, trimMargin, trimMargin);
+                origin += pageRect.topLeft();
+            }
+
+            RectF clipRect = pageRect;
+            if (tileRect.isValid()) {
+                origin += tileRect.topLeft();
+                clipRect = clipRect.intersected(tileRect.translated(pageRect.topLeft()));
+            }
+
+            //! NOTE Notify about new page (usually for paged paint device, ex pdf, printer)
+            if (pi != fromPage && opt.onNewPage) {
+                opt.onNewPage();
+            }
+
+            painter->save();
+            painter->translate(-translation);
+            painter->setViewport(viewport);
+            painter->setWindow(RectF(origin, window.size()));
+
+            if (opt.printPageBackground) {
+                painter->fillRect(pageRect, Color::WHITE);
+            }
+
+            painter->setClipping(true);
+            painter->setClipRect(clipRect);
+
+            for (const PageDisplayLists::Chunk& chunk : page.chunks) {
+                if (chunk.bbox.intersects(clipRect)) {
+                    DrawDataPaint::paint(painter, chunk.drawData);
+                }
+            }
+
+            painter->restore();
+        }
+
+        if ((copy + 1) < opt.copyCount && opt.onNewPage) {
+            opt.onNewPage();
+        }
+    }
+
+    //! NOTE Leave the painter mapped as paintScore does, callers may continue painting in page coordinates
+    painter->setViewport(viewport);
+    painter->setWindow(window);
+
+    return true;
+}
@@ -22,8 +22,11 @@
 
 #pragma once
 
+#include <vector>
+
 #include "../inotationpainting.h"
 
+#include "async/asyncable.h"
 #include "modularity/ioc.h"
 #include "../inotationconfiguration.h"
 #include "engraving/iengravingconfiguration.h"
@@ -37,7 +40,7 @@ class Page;
 
 namespace mu::notation {
 class Notation;
-class NotationPainting : public INotationPainting, public muse::Contextable
+class NotationPainting : public INotationPainting, public muse::Contextable, public muse::async::Asyncable
 {
     muse::GlobalInject<INotationConfiguration> configuration;
     muse::GlobalInject<engraving::IEngravingConfiguration> engravingConfiguration;
@@ -60,6 +63,11 @@ public:
     void paintPrint(muse::draw::Painter* painter, const Options& opt) override;
     void paintPng(muse::draw::Painter* painter, const Options& opt) override;
 
+    void recordPageDisplayLists(int fromPage, int toPage) override;
+    void clearPageDisplayLists() override;
+    PageDisplayListsPtr pageDisplayLists() const override;
+    bool paintRecordedPdf(muse::draw::Painter* painter, const Options& opt, const PageDisplayListsPtr& recordedPages) const override;
+
 private:
     mu::engraving::Score* score() const;
 
@@ -69,8 +77,32 @@ private:
     void paintPageSheet(muse::draw::Painter* painter, const engraving::Page* page, const muse::RectF& pageRect,
                         bool printPageBackground) const;
 
+    bool replayPageDisplayLists(muse::draw::Painter* painter, const Options& opt) const;
+    static bool replay(muse::draw::Painter* painter, const Options& opt, const PageDisplayLists& recordedPages);
+
     Notation* m_notation = nullptr;
 
+    //! NOTE The state of the score the pages were recorded from
+    struct RecordedRevision {
+        size_t scoreRevision = muse::nidx;
+        size_t unattributedRevision = muse::nidx;
+        ViewMode viewMode = ViewMode::PAGE;
+        size_t pageCount = 0;
+
+        bool operator==(const RecordedRevision& other) const
+        {
+            return scoreRevision == other.scoreRevision
+                   && unattributedRevision == other.unattributedRevision
+                   && viewMode == other.viewMode
+                   && pageCount == other.pageCount;
+        }
+    };
+
+    RecordedRevision currentRevision() const;
+
+    PageDisplayListsPtr m_pageDisplayLists;
+    RecordedRevision m_recordedRevision;
+
     muse::async::Notification m_viewModeChanged;
 };
 }
@@ -229,6 +229,15 @@ size_t NotationUndoStack::currentStateIndex() const
     return undoStack()->currentIndex();
 }
 
+size_t NotationUndoStack::firstStateIndex() const
+{
+    IF_ASSERT_FAILED(undoStack()) {
+        return 0;
+    }
+
+    return undoStack()->firstIndex();
+}
+
 const muse::TranslatableString NotationUndoStack::lastActionNameAtIdx(size_t idx) const
 {
     IF_ASSERT_FAILED(undoStack()) {
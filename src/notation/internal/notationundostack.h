@@ -62,6 +62,7 @@ public:
     const muse::TranslatableString topMostRedoActionName() const override;
     size_t undoRedoActionCount() const override;
     size_t currentStateIndex() const override;
+    size_t firstStateIndex() const override;
     const muse::TranslatableString lastActionNameAtIdx(size_t idx) const override;
 
     muse::async::Notification stackChanged() const override;
@@ -0,0 +1,52 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "testing/environment.h"
+
+#include "draw/drawmodule.h"
+#include "engraving/engravingmodule.h"
+
+#include "engraving/dom/instrtemplate.h"
+#include "engraving/dom/mscore.h"
+
+#include "engraving/tests/utils/scorerw.h"
+
+#include "mocks/notationconfigurationmock.h"
+
+#include "log.h"
+
+static muse::testing::SuiteEnvironment notation_se
+    = muse::testing::SuiteEnvironment()
+      .setDependencyModules({ new muse::draw::DrawModule(), new mu::engraving::EngravingModule() })
+      .setPostInit([]() {
+    LOGI() << "notation tests suite post init";
+
+    mu::engraving::ScoreRW::setRootPath(muse::String::fromUtf8(notation_tests_DATA_ROOT));
+
+    mu::engraving::MScore::testMode = true;
+    mu::engraving::MScore::noGui = true;
+
+    mu::engraving::loadInstrumentTemplates(":/engraving/instruments/instruments.xml");
+
+    using NCMock = ::testing::NiceMock<mu::notation::NotationConfigurationMock>;
+    muse::modularity::globalIoc()->registerExport<mu::notation::INotationConfiguration>("utests", std::make_shared<NCMock>());
+});
@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/page.h"
+
+#include "engraving/tests/utils/scorerw.h"
+
+#include "notation/internal/notation.h"
+
+#include "log.h"
+
+using namespace mu::notation;
+using namespace mu::engraving;
+using namespace muse;
+
+static const String DENSE_SCORE(u"all_elements_data/moonlight.mscx");
+static constexpr float HIT_WIDTH = 4.0;
+
+class Notation_NotationInteractionTests : public ::testing::Test
+{
+public:
+    //! NOTE A mouse-move trace: a zig-zag over every page, as produced by hovering the whole score
+    static std::vector<PointF> mouseMoveTrace(const Score* score, int rows, int cols)
+    {
+        std::vector<PointF> trace;
+        for (const Page* page : score->pages()) {
+            const RectF pageRect = page->ldata()->bbox().translated(page->pos());
+            for (int row = 0; row < rows; ++row) {
+                double y = pageRect.top() + pageRect.height() * row / rows;
+                for (int col = 0; col < cols; ++col) {
+                    int c = (row % 2) ? cols - 1 - col : col;
+                    trace.emplace_back(pageRect.left() + pageRect.width() * c / cols, y);
+                }
+            }
+        }
+
+        return trace;
+    }
+};
+
+/**
+ * @brief Notation_NotationInteractionTests_HitElementIsTopmostOfHitElements
+ * @details Check that the element hit on mouse move is the most interesting one of all the elements hit there
+ */
+TEST_F(Notation_NotationInteractionTests, HitElementIsTopmostOfHitElements)
+{
+    MasterScore* score = ScoreRW::readScore(DENSE_SCORE);
+    ASSERT_TRUE(score);
+
+    auto notation = std::make_shared<Notation>(nullptr, score->iocContext(), score);
+    INotationInteractionPtr interaction = notation->interaction();
+
+    for (const PointF& pos : mouseMoveTrace(score, 40, 40)) {
+        std::vector<EngravingItem*> elements = interaction->hitElements(pos, HIT_WIDTH);
+        EngravingItem* expected = elements.empty() ? nullptr : elements.back();
+
+        EXPECT_EQ(interaction->hitElement(pos, HIT_WIDTH), expected);
+    }
+
+    notation.reset();
+    delete score;
+}
+
+/**
+ * @brief Notation_NotationInteractionTests_HitElementTraceBenchmark
+ * @details Replays a mouse-move trace over a dense score through hitElement and logs the timing.
+ *          Disabled by default; run with --gtest_also_run_disabled_tests --gtest_filter=*HitElementTraceBenchmark*
+ */
+TEST_F(Notation_NotationInteractionTests, DISABLED_HitElementTraceBenchmark)
+{
+    MasterScore* score = ScoreRW::readScore(DENSE_SCORE);
+    ASSERT_TRUE(score);
+
+    auto notation = std::make_shared<Notation>(nullptr, score->iocContext(), score);
+    INotationInteractionPtr interaction = notation->interaction();
+
+    const std::vector<PointF> trace = mouseMoveTrace(score, 200, 200);
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t hits = 0;
+    Clock::time_point start = Clock::now();
+    for (const PointF& pos : trace) {
+        if (interaction->hitElement(pos, HIT_WIDTH)) {
+            ++hits;
+        }
+    }
+    auto time = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+
+    LOGI() << "hitElement trace of " << trace.size() << " moves over " << score->pages().size() << " pages: "
+           << time.count() << " us, " << hits << " hits";
+
+    notation.reset();
+    delete score;
+}
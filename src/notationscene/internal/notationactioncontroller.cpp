@@ -581,6 +581,9 @@ void NotationActionController::init()
         });
     }
     dispatcher()->reg(this, "check-for-score-corruptions", [this] { checkForScoreCorruptions(); });
+    dispatcher()->reg(this, "diagnostic-show-engraving-cmdlatency", [this] {
+        interactive()->open("musescore://diagnostics/engraving/cmdlatency");
+    });
 }
 
 bool NotationActionController::canReceiveAction(const ActionCode& code) const
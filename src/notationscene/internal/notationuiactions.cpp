@@ -2775,6 +2775,11 @@ const UiActionList NotationUiActions::s_engravingDebuggingActions = {
              mu::context::CTX_NOTATION_OPENED,
              TranslatableString("action", "Check for score corruptions")
              ),
+    UiAction("diagnostic-show-engraving-cmdlatency",
+             mu::context::UiCtxProjectOpened,
+             mu::context::CTX_NOTATION_OPENED,
+             TranslatableString("action", "Show command latency")
+             ),
     UiAction("edit-strings",
              mu::context::UiCtxProjectOpened,
              mu::context::CTX_NOTATION_OPENED
@@ -55,7 +55,8 @@ void UndoHistoryModel::onCurrentNotationChanged()
     }
 
     beginResetModel();
-    m_rowCount = stack ? int(stack->undoRedoActionCount()) + 1 : 0;
+    m_firstStateIndex = stack ? stack->firstStateIndex() : 0;
+    m_rowCount = stack ? int(stack->undoRedoActionCount() - m_firstStateIndex) + 1 : 0;
     endResetModel();
 
     emit currentIndexChanged();
@@ -65,7 +66,19 @@ void UndoHistoryModel::onUndoRedo()
 {
     auto stack = undoStack();
 
-    int newRowCount = stack ? int(stack->undoRedoActionCount()) + 1 : 0;
+    //! NOTE The oldest states were dropped from the history, so every row now shows a different state
+    size_t newFirstStateIndex = stack ? stack->firstStateIndex() : 0;
+    if (newFirstStateIndex != m_firstStateIndex) {
+        beginResetModel();
+        m_firstStateIndex = newFirstStateIndex;
+        m_rowCount = stack ? int(stack->undoRedoActionCount() - m_firstStateIndex) + 1 : 0;
+        endResetModel();
+
+        emit currentIndexChanged();
+        return;
+    }
+
+    int newRowCount = stack ? int(stack->undoRedoActionCount() - m_firstStateIndex) + 1 : 0;
 
     if (m_rowCount < newRowCount) {
         beginInsertRows(QModelIndex(), m_rowCount, newRowCount - 1);
@@ -81,7 +94,7 @@ void UndoHistoryModel::onUndoRedo()
     // redo stack is cleared, and the new action is pushed onto the stack;
     // that means that the item at the current index now represents the new
     // action, rather than the action on the redo stack.
-    int newCurrentIndex = stack ? int(stack->currentStateIndex()) : 0;
+    int newCurrentIndex = stack ? int(stack->currentStateIndex() - m_firstStateIndex) : 0;
     emit dataChanged(index(newCurrentIndex), index(newCurrentIndex));
 
     emit currentIndexChanged();
@@ -91,16 +104,18 @@ QVariant UndoHistoryModel::data(const QModelIndex& index, int role) const
 {
     auto stack = undoStack();
     int row = index.row();
-    if (!stack || row < 0 || row >= int(stack->undoRedoActionCount()) + 1) {
+    if (!stack || row < 0 || row >= m_rowCount) {
         return {};
     }
 
     switch (role) {
     case Qt::DisplayRole:
         if (row == 0) {
-            return qtrc("notation/undohistory", "File opened");
+            return m_firstStateIndex == 0
+                   ? qtrc("notation/undohistory", "File opened")
+                   : qtrc("notation/undohistory", "Earlier actions removed");
         }
-        return stack->lastActionNameAtIdx(static_cast<size_t>(row)).qTranslated();
+        return stack->lastActionNameAtIdx(m_firstStateIndex + static_cast<size_t>(row)).qTranslated();
     default:
         return {};
     }
@@ -119,7 +134,7 @@ QHash<int, QByteArray> UndoHistoryModel::roleNames() const
 int UndoHistoryModel::currentIndex() const
 {
     if (auto stack = undoStack()) {
-        return int(stack->currentStateIndex());
+        return int(stack->currentStateIndex() - m_firstStateIndex);
     }
 
     return 0;
@@ -132,7 +147,7 @@ void UndoHistoryModel::undoRedoToIndex(int index)
         return;
     }
 
-    return notation->interaction()->undoRedoToIndex(static_cast<size_t>(index));
+    return notation->interaction()->undoRedoToIndex(m_firstStateIndex + static_cast<size_t>(index));
 }
 
 INotationUndoStackPtr UndoHistoryModel::undoStack() const
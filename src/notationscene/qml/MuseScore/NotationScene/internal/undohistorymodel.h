@@ -66,5 +66,6 @@ private:
     INotationUndoStackPtr undoStack() const;
 
     int m_rowCount = 0;
+    size_t m_firstStateIndex = 0;
 };
 }
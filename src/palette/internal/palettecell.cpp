@@ -22,6 +22,8 @@
 #include "palettecell.h"
 #include "palettecompat.h"
 
+#include <QHash>
+
 #include "mimedatautils.h"
 
 #include "engraving/dom/actionicon.h"
@@ -172,7 +174,29 @@ void PaletteCell::retranslate()
         TextBase* orig = toTextBase(untranslatedElement.get());
         const QString& text = orig->xmlText();
         target->setXmlText(muse::qtrc("palette", text.toUtf8().constData()));
+        elementChanged();
+    }
+}
+
+//! NOTE The element is remembered by a weak pointer rather than its address,
+//! which may be reused by another element after this one is deleted
+size_t PaletteCell::contentKey() const
+{
+    if (!element) {
+        return 0;
     }
+
+    if (m_contentKeyElement.lock() != element) {
+        m_contentKey = qHash(element->mimeData().toQByteArray());
+        m_contentKeyElement = element;
+    }
+
+    return m_contentKey;
+}
+
+void PaletteCell::elementChanged()
+{
+    m_contentKeyElement.reset();
 }
 
 void PaletteCell::setElementTranslated(bool translate)
@@ -91,6 +91,11 @@ public:
     static PaletteCellPtr fromMimeData(const QByteArray& data, const muse::modularity::ContextPtr& iocCtx);
     static PaletteCellPtr fromElementMimeData(const QByteArray& data, const muse::modularity::ContextPtr& iocCtx);
 
+    //! NOTE Hash of the serialized element, computed once per element (see PaletteCellIconCache).
+    //! Call elementChanged() after changing the element in place
+    size_t contentKey() const;
+    void elementChanged();
+
     mu::engraving::ElementPtr element;
     mu::engraving::ElementPtr untranslatedElement;
     QString id;
@@ -110,6 +115,9 @@ public:
 
 private:
     static QString makeId();
+
+    mutable std::weak_ptr<mu::engraving::EngravingItem> m_contentKeyElement;
+    mutable size_t m_contentKey = 0;
 };
 }
 
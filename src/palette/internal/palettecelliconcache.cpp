@@ -0,0 +1,200 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "palettecelliconcache.h"
+
+#include <algorithm>
+
+#include <QGuiApplication>
+#include <QPainter>
+#include <QtMath>
+
+#include "draw/painter.h"
+
+#include "engraving/dom/engravingitem.h"
+#include "engraving/dom/score.h"
+#include "engraving/iengravingfont.h"
+
+#include "notationscene/utilities/engravingitempreviewpainter.h"
+
+using namespace mu::palette;
+using namespace muse::draw;
+using namespace mu::engraving;
+
+//! NOTE Cost is counted in KiB
+static constexpr int MAX_CACHE_COST = 64 * 1024;
+
+static constexpr int WARM_UP_START_DELAY_MS = 2000;
+static constexpr int WARM_UP_STEP_INTERVAL_MS = 10;
+static constexpr size_t WARM_UP_CELLS_PER_STEP = 8;
+
+PaletteCellIconCache* PaletteCellIconCache::instance()
+{
+    static PaletteCellIconCache cache;
+    return &cache;
+}
+
+PaletteCellIconCache::PaletteCellIconCache()
+{
+    m_pixmaps.setMaxCost(MAX_CACHE_COST);
+
+    m_warmUpTimer.setSingleShot(true);
+    QObject::connect(&m_warmUpTimer, &QTimer::timeout, [this]() {
+        warmUpNext();
+    });
+
+    configuration()->colorsChanged().onNotify(this, [this]() {
+        clear();
+    });
+}
+
+QPixmap PaletteCellIconCache::pixmap(const PaletteCellConstPtr& cell, qreal extraMag, const QSize& size, qreal dpr)
+{
+    if (!cell || !cell->element || size.isEmpty()) {
+        return QPixmap();
+    }
+
+    const QString key = cacheKey(cell, extraMag, size, dpr);
+    if (const QPixmap* cached = m_pixmaps.object(key)) {
+        return *cached;
+    }
+
+    QPixmap pixmap = render(cell, extraMag, size, dpr);
+    const int cost = std::max(1, static_cast<int>(static_cast<qint64>(pixmap.width()) * pixmap.height() * 4 / 1024));
+    m_pixmaps.insert(key, new QPixmap(pixmap), cost);
+
+    return pixmap;
+}
+
+//! NOTE The key covers everything the rendered image depends on:
+//! the element content, the cell display settings, the target size and pixel ratio,
+//! the theme (via the elements color) and the engraving font.
+//! The element is identified by the hash of its serialized content kept by the cell (see PaletteCell::contentKey)
+QString PaletteCellIconCache::cacheKey(const PaletteCellConstPtr& cell, qreal extraMag, const QSize& size, qreal dpr) const
+{
+    const EngravingItem* element = cell->element.get();
+
+    QString fontName;
+    if (element->score() && element->score()->engravingFont()) {
+        fontName = QString::fromStdString(element->score()->engravingFont()->name());
+    }
+
+    return QStringLiteral("%1|%2|%3|%4|%5|%6|%7x%8|%9|%10|%11|%12")
+           .arg(cell->contentKey(), 0, 16)
+           .arg(cell->mag)
+           .arg(cell->xoffset)
+           .arg(cell->yoffset)
+           .arg(cell->drawStaff)
+           .arg(extraMag)
+           .arg(size.width())
+           .arg(size.height())
+           .arg(dpr)
+           .arg(configuration()->elementsColor().rgba())
+           .arg(configuration()->paletteSpatium())
+           .arg(fontName);
+}
+
+QPixmap PaletteCellIconCache::render(const PaletteCellConstPtr& cell, qreal extraMag, const QSize& size, qreal dpr) const
+{
+    QPixmap pixmap(qCeil(size.width() * dpr), qCeil(size.height() * dpr));
+    pixmap.setDevicePixelRatio(dpr);
+    pixmap.fill(Qt::transparent);
+
+    {
+        QPainter qp(&pixmap);
+        Painter painter(&qp, "palettecell");
+        painter.setAntialiasing(true);
+
+        notation::EngravingItemPreviewPainter::PaintParams params;
+        params.painter = &painter;
+
+        params.color = configuration()->elementsColor();
+
+        params.mag = extraMag * cell->mag;
+        params.xoffset = cell->xoffset;
+        params.yoffset = cell->yoffset;
+
+        params.rect = RectF(0.0, 0.0, size.width(), size.height());
+        params.spatium = configuration()->paletteSpatium() * params.mag;
+
+        //! NOTE: Slight hack - we can now specify exactly now many staff lines we want...
+        params.numStaffLines = cell->drawStaff ? 5 : 0;
+
+        notation::EngravingItemPreviewPainter::paintPreview(engravingRender(), cell->element.get(), params);
+    }
+
+    return pixmap;
+}
+
+//! NOTE Palette elements share the palette score and QPixmap is bound to the GUI thread,
+//! so warming up happens on the main thread, a few cells per event loop iteration
+void PaletteCellIconCache::warmUp(const PaletteTreePtr& tree)
+{
+    if (!tree) {
+        return;
+    }
+
+    for (const PalettePtr& palette : tree->palettes) {
+        const qreal extraMag = palette->mag() * configuration()->paletteScaling();
+        const QSize size = palette->scaledGridSize();
+        for (const PaletteCellPtr& cell : palette->cells()) {
+            if (cell && cell->element) {
+                m_warmUpQueue.push_back({ cell, extraMag, size });
+            }
+        }
+    }
+
+    if (!m_warmUpTimer.isActive()) {
+        m_warmUpTimer.start(WARM_UP_START_DELAY_MS);
+    }
+}
+
+void PaletteCellIconCache::warmUpNext()
+{
+    const qreal dpr = qApp->devicePixelRatio();
+
+    size_t rendered = 0;
+    while (!m_warmUpQueue.empty() && rendered < WARM_UP_CELLS_PER_STEP) {
+        WarmUpItem item = m_warmUpQueue.back();
+        m_warmUpQueue.pop_back();
+
+        if (PaletteCellConstPtr cell = item.cell.lock()) {
+            pixmap(cell, item.extraMag, item.size, dpr);
+            ++rendered;
+        }
+    }
+
+    if (!m_warmUpQueue.empty()) {
+        m_warmUpTimer.start(WARM_UP_STEP_INTERVAL_MS);
+    }
+}
+
+void PaletteCellIconCache::clear()
+{
+    m_pixmaps.clear();
+}
+
+void PaletteCellIconCache::deinit()
+{
+    m_warmUpTimer.stop();
+    m_warmUpQueue.clear();
+    m_pixmaps.clear();
+}
@@ -0,0 +1,75 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QPixmap>
+#include <QTimer>
+
+#include "palettetree.h"
+
+#include "async/asyncable.h"
+#include "modularity/ioc.h"
+#include "ipaletteconfiguration.h"
+#include "engraving/rendering/isinglerenderer.h"
+
+namespace mu::palette {
+//! NOTE Rendered palette cell elements, shared by all palette views.
+//! Rendering a cell lays out and draws its element through the engraving renderer,
+//! which is far too slow to repeat on every repaint of the master palette.
+//! Only the element itself is cached, the selection background is painted on top by the icon engine.
+class PaletteCellIconCache : public muse::async::Asyncable
+{
+    muse::GlobalInject<IPaletteConfiguration> configuration;
+    muse::GlobalInject<engraving::rendering::ISingleRenderer> engravingRender;
+
+public:
+    static PaletteCellIconCache* instance();
+
+    QPixmap pixmap(const PaletteCellConstPtr& cell, qreal extraMag, const QSize& size, qreal dpr);
+
+    //! NOTE Renders the cells of the given tree in small idle steps, so the palettes are ready when first shown
+    void warmUp(const PaletteTreePtr& tree);
+
+    void clear();
+    void deinit();
+
+private:
+    PaletteCellIconCache();
+
+    QString cacheKey(const PaletteCellConstPtr& cell, qreal extraMag, const QSize& size, qreal dpr) const;
+    QPixmap render(const PaletteCellConstPtr& cell, qreal extraMag, const QSize& size, qreal dpr) const;
+
+    void warmUpNext();
+
+    struct WarmUpItem {
+        std::weak_ptr<const PaletteCell> cell;
+        qreal extraMag = 1.0;
+        QSize size;
+    };
+
+    QCache<QString, QPixmap> m_pixmaps;
+    std::vector<WarmUpItem> m_warmUpQueue;
+    QTimer m_warmUpTimer;
+};
+}
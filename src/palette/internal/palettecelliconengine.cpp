@@ -26,13 +26,10 @@
 #include "draw/painter.h"
 #include "draw/types/geometry.h"
 
-#include "engraving/dom/engravingitem.h"
-
-#include "notationscene/utilities/engravingitempreviewpainter.h"
+#include "palettecelliconcache.h"
 
 using namespace mu::palette;
 using namespace muse::draw;
-using namespace mu::engraving;
 
 PaletteCellIconEngine::PaletteCellIconEngine(PaletteCellConstPtr cell, qreal extraMag)
     : QIconEngine(), m_cell(cell), m_extraMag(extraMag)
@@ -49,39 +46,18 @@ void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode m
     Painter p(qp, "palettecell");
     p.save();
     p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On);
+    paintBackground(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On);
     p.restore();
-}
-
-void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current) const
-{
-    paintBackground(painter, rect, selected, current);
 
-    if (!m_cell) {
+    if (!m_cell || !m_cell->element) {
         return;
     }
 
-    EngravingItem* element = m_cell->element.get();
-    if (!element) {
-        return;
+    const qreal dpr = qp->device() ? qp->device()->devicePixelRatioF() : 1.0;
+    const QPixmap pixmap = PaletteCellIconCache::instance()->pixmap(m_cell, m_extraMag, rect.size(), dpr);
+    if (!pixmap.isNull()) {
+        qp->drawPixmap(rect.topLeft(), pixmap);
     }
-
-    notation::EngravingItemPreviewPainter::PaintParams params;
-    params.painter = &painter;
-
-    params.color = configuration()->elementsColor();
-
-    params.mag = m_extraMag * m_cell->mag;
-    params.xoffset = m_cell->xoffset;
-    params.yoffset = m_cell->yoffset;
-
-    params.rect = rect;
-    params.spatium = configuration()->paletteSpatium() * params.mag;
-
-    //! NOTE: Slight hack - we can now specify exactly now many staff lines we want...
-    params.numStaffLines = m_cell->drawStaff ? 5 : 0;
-
-    notation::EngravingItemPreviewPainter::paintPreview(engravingRender(), element, params);
 }
 
 void PaletteCellIconEngine::paintBackground(Painter& painter, const RectF& rect, bool selected, bool current) const
@@ -28,7 +28,6 @@
 
 #include "modularity/ioc.h"
 #include "ipaletteconfiguration.h"
-#include "engraving/rendering/isinglerenderer.h"
 
 namespace muse::draw {
 class Painter;
@@ -38,7 +37,6 @@ namespace mu::palette {
 class PaletteCellIconEngine : public QIconEngine
 {
     muse::GlobalInject<IPaletteConfiguration> configuration;
-    muse::GlobalInject<engraving::rendering::ISingleRenderer> engravingRender;
 
 public:
     explicit PaletteCellIconEngine(PaletteCellConstPtr cell, qreal extraMag = 1.0);
@@ -48,7 +46,6 @@ public:
     void paint(QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state) override;
 
 private:
-    void paintCell(muse::draw::Painter& painter, const muse::RectF& rect, bool selected, bool current) const;
     void paintBackground(muse::draw::Painter& painter, const muse::RectF& rect, bool selected, bool current) const;
 
     PaletteCellConstPtr m_cell;
@@ -32,6 +32,7 @@
 #include "engraving/dom/mscore.h"
 
 #include "palettecreator.h"
+#include "palettecelliconcache.h"
 
 #include "io/path.h"
 
@@ -602,7 +603,9 @@ void PaletteProvider::init()
     m_userPaletteModel = new PaletteTreeModel(std::make_shared<PaletteTree>(), iocContext(), this);
     connect(m_userPaletteModel, &PaletteTreeModel::treeChanged, this, &PaletteProvider::notifyAboutUserPaletteChanged);
 
-    m_masterPaletteModel = new PaletteTreeModel(PaletteCreator(iocContext()).newMasterPaletteTree(), iocContext(), this);
+    PaletteTreePtr masterPaletteTree = PaletteCreator(iocContext()).newMasterPaletteTree();
+    m_masterPaletteModel = new PaletteTreeModel(masterPaletteTree, iocContext(), this);
+    PaletteCellIconCache::instance()->warmUp(masterPaletteTree);
 
     m_searchFilterModel = new PaletteCellFilterProxyModel(this);
     m_searchFilterModel->setFilterCaseSensitivity(Qt::CaseInsensitive);
@@ -977,6 +980,8 @@ void PaletteProvider::setUserPaletteTree(PaletteTreePtr tree)
         m_userPaletteModel = new PaletteTreeModel(tree, iocContext(), /* parent */ this);
         connect(m_userPaletteModel, &PaletteTreeModel::treeChanged, this, &PaletteProvider::notifyAboutUserPaletteChanged);
     }
+
+    PaletteCellIconCache::instance()->warmUp(tree);
 }
 
 void PaletteProvider::setDefaultPaletteTree(PaletteTreePtr tree)
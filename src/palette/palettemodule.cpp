@@ -34,6 +34,7 @@
 #include "internal/paletteworkspacesetup.h"
 #include "internal/paletteprovider.h"
 #include "internal/palettecell.h"
+#include "internal/palettecelliconcache.h"
 
 #include "widgets/masterpalette.h"
 #include "widgets/specialcharactersdialog.h"
@@ -87,6 +88,11 @@ void PaletteModule::onInit(const IApplication::RunMode&)
     m_configuration->init();
 }
 
+void PaletteModule::onDeinit()
+{
+    PaletteCellIconCache::instance()->deinit();
+}
+
 IContextSetup* PaletteModule::newContext(const muse::modularity::ContextPtr& ctx) const
 {
     return new PaletteContext(ctx);
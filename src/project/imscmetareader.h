@@ -43,5 +43,9 @@ public:
     virtual muse::RetVal<QPixmap> readThumbnail(const muse::io::path_t& filePath) const = 0;
     virtual muse::RetVal<ProjectMeta> readMeta(const muse::io::path_t& filePath) const = 0;
     virtual muse::RetVal<CloudProjectInfo> readCloudProjectInfo(const muse::io::path_t& filePath) const = 0;
+
+    //! NOTE Reads the meta and the musical overview (measures, duration, key and time signatures)
+    //! in a single pass over the score file, without loading the score
+    virtual muse::RetVal<ProjectProbe> probe(const muse::io::path_t& filePath) const = 0;
 };
 }
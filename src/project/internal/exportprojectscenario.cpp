@@ -134,11 +134,11 @@ bool ExportProjectScenario::exportScores(notation::INotationPtrList notations, c
 
     masterNotation()->initExcerpts(excerptsToInit);
 
-    // Scores that are closed may have never been laid out, so we lay them out now
+    // Scores that are closed may have never been laid out or may be out of date, so we lay them out now
     for (const INotationPtr& notation : notations) {
         mu::engraving::Score* score = notation->elements()->msScore();
         if (!score->autoLayoutEnabled()) {
-            score->doLayout();
+            score->doPendingLayout();
         }
     }
 
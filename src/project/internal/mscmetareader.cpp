@@ -21,6 +21,9 @@
  */
 #include "mscmetareader.h"
 
+#include <cstdlib>
+#include <optional>
+
 #include "global/io/buffer.h"
 #include "global/serialization/xmlstreamreader.h"
 
@@ -138,6 +141,34 @@ muse::RetVal<CloudProjectInfo> MscMetaReader::readCloudProjectInfo(const muse::i
     return info;
 }
 
+RetVal<ProjectProbe> MscMetaReader::probe(const muse::io::path_t& filePath) const
+{
+    TRACEFUNC;
+
+    MscReader msczReader;
+    Ret ret = prepareReader(filePath, msczReader);
+    if (!ret) {
+        return ret;
+    }
+
+    auto scoreData = Buffer::opened(IODevice::ReadOnly, msczReader.readScoreFile());
+    XmlStreamReader xmlReader(&scoreData);
+
+    RawProbe rawProbe;
+
+    RetVal<ProjectProbe> result;
+    result.ret = make_ok();
+    doReadMeta(xmlReader, result.val.meta, &rawProbe);
+
+    result.val.meta.filePath = filePath;
+    result.val.measuresCount = rawProbe.measuresCount;
+    result.val.durationSecs = rawProbe.durationSecs;
+    result.val.keySignatures = std::move(rawProbe.keySignatures);
+    result.val.timeSignatures = std::move(rawProbe.timeSignatures);
+
+    return result;
+}
+
 Ret MscMetaReader::prepareReader(const muse::io::path_t& filePath, MscReader& reader) const
 {
     Ret ret = fileSystem()->exists(filePath);
@@ -225,9 +256,100 @@ MscMetaReader::RawMeta MscMetaReader::doReadBox(XmlStreamReader& xmlReader) cons
     return meta;
 }
 
-MscMetaReader::RawMeta MscMetaReader::doReadRawMeta(XmlStreamReader& xmlReader) const
+void MscMetaReader::doReadMeasure(XmlStreamReader& xmlReader, RawProbe& probe) const
+{
+    //! NOTE The measure length is stored only if it differs from the time signature
+    const std::string len(xmlReader.asciiAttribute("len"));
+
+    while (xmlReader.readNextStartElement()) {
+        if (xmlReader.name() == "voice") {
+            while (xmlReader.readNextStartElement()) {
+                doReadMeasureElement(xmlReader, probe);
+            }
+        } else {
+            // before 3.01 the measure elements aren't grouped by voice
+            doReadMeasureElement(xmlReader, probe);
+        }
+    }
+
+    double quarters = 4.0 * probe.timeSigNumerator / probe.timeSigDenominator;
+    const size_t slash = len.find('/');
+    if (slash != std::string::npos) {
+        const int numerator = std::atoi(len.substr(0, slash).c_str());
+        const int denominator = std::atoi(len.substr(slash + 1).c_str());
+        if (numerator > 0 && denominator > 0) {
+            quarters = 4.0 * numerator / denominator;
+        }
+    }
+
+    //! NOTE A tempo change is applied from the start of the measure it is in
+    probe.durationSecs += quarters / probe.tempo;
+    probe.measuresCount++;
+}
+
+void MscMetaReader::doReadMeasureElement(XmlStreamReader& xmlReader, RawProbe& probe) const
+{
+    const std::string tag(xmlReader.name());
+
+    if (tag == "TimeSig") {
+        int numerator = 0;
+        int denominator = 0;
+        while (xmlReader.readNextStartElement()) {
+            const std::string sigTag(xmlReader.name());
+            if (sigTag == "sigN") {
+                numerator = xmlReader.readInt();
+            } else if (sigTag == "sigD") {
+                denominator = xmlReader.readInt();
+            } else {
+                xmlReader.skipCurrentElement();
+            }
+        }
+
+        if (numerator <= 0 || denominator <= 0) {
+            return;
+        }
+
+        if (probe.timeSignatures.isEmpty() || numerator != probe.timeSigNumerator || denominator != probe.timeSigDenominator) {
+            probe.timeSignatures << QString("%1/%2").arg(numerator).arg(denominator);
+        }
+
+        probe.timeSigNumerator = numerator;
+        probe.timeSigDenominator = denominator;
+    } else if (tag == "KeySig") {
+        std::optional<int> key;
+        while (xmlReader.readNextStartElement()) {
+            const std::string keyTag(xmlReader.name());
+            if (keyTag == "concertKey" || keyTag == "accidental") {
+                key = xmlReader.readInt();
+            } else {
+                xmlReader.skipCurrentElement();
+            }
+        }
+
+        if (key && (probe.keySignatures.empty() || probe.keySignatures.back() != key.value())) {
+            probe.keySignatures.push_back(key.value());
+        }
+    } else if (tag == "Tempo") {
+        while (xmlReader.readNextStartElement()) {
+            if (xmlReader.name() == "tempo") {
+                bool ok = false;
+                const double tempo = xmlReader.readDouble(&ok);
+                if (ok && tempo > 0.0) {
+                    probe.tempo = tempo;
+                }
+            } else {
+                xmlReader.skipCurrentElement();
+            }
+        }
+    } else {
+        xmlReader.skipCurrentElement();
+    }
+}
+
+MscMetaReader::RawMeta MscMetaReader::doReadRawMeta(XmlStreamReader& xmlReader, RawProbe* probe) const
 {
     RawMeta meta;
+    bool isFirstStaff = true;
 
     while (xmlReader.readNextStartElement()) {
         const std::string tag(xmlReader.name());
@@ -255,14 +377,22 @@ MscMetaReader::RawMeta MscMetaReader::doReadRawMeta(XmlStreamReader& xmlReader)
                 meta.additionalTags[QString::fromUtf8(name)] = readMetaTagText(xmlReader);
             }
         } else if (tag == "Staff") {
-            if (meta.titleStyle.isEmpty()) {
+            //! NOTE The measures are the same in all staves, and the system elements (tempo etc.) are in the first one
+            const bool readBoxes = meta.titleStyle.isEmpty();
+            const bool readMeasures = probe && isFirstStaff;
+            isFirstStaff = false;
+
+            if (readBoxes || readMeasures) {
                 while (xmlReader.readNextStartElement()) {
                     const std::string boxTag(xmlReader.name());
 
-                    if (boxTag == "HBox"
-                        || boxTag == "VBox"
-                        || boxTag == "TBox"
-                        || boxTag == "FBox") {
+                    if (readMeasures && boxTag == "Measure") {
+                        doReadMeasure(xmlReader, *probe);
+                    } else if (readBoxes
+                               && (boxTag == "HBox"
+                                   || boxTag == "VBox"
+                                   || boxTag == "TBox"
+                                   || boxTag == "FBox")) {
                         RawMeta boxMeta = doReadBox(xmlReader);
 
                         meta.titleStyle = boxMeta.titleStyle;
@@ -291,7 +421,7 @@ MscMetaReader::RawMeta MscMetaReader::doReadRawMeta(XmlStreamReader& xmlReader)
     return meta;
 }
 
-void MscMetaReader::doReadMeta(XmlStreamReader& xmlReader, ProjectMeta& meta) const
+void MscMetaReader::doReadMeta(XmlStreamReader& xmlReader, ProjectMeta& meta, RawProbe* probe) const
 {
     RawMeta rawMeta;
 
@@ -301,11 +431,11 @@ void MscMetaReader::doReadMeta(XmlStreamReader& xmlReader, ProjectMeta& meta) co
             bool suitedVersion = version.rfind("1", 0) == 0;
 
             if (suitedVersion) {
-                rawMeta = doReadRawMeta(xmlReader);
+                rawMeta = doReadRawMeta(xmlReader, probe);
             } else {
                 while (xmlReader.readNextStartElement()) {
                     if (xmlReader.name() == "Score") {
-                        rawMeta = doReadRawMeta(xmlReader);
+                        rawMeta = doReadRawMeta(xmlReader, probe);
                     } else {
                         xmlReader.skipCurrentElement();
                     }
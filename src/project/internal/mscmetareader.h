@@ -40,6 +40,7 @@ public:
     muse::RetVal<QPixmap> readThumbnail(const muse::io::path_t& filePath) const override;
     muse::RetVal<ProjectMeta> readMeta(const muse::io::path_t& filePath) const override;
     muse::RetVal<CloudProjectInfo> readCloudProjectInfo(const muse::io::path_t& filePath) const override;
+    muse::RetVal<ProjectProbe> probe(const muse::io::path_t& filePath) const override;
 
 private:
 
@@ -71,11 +72,25 @@ private:
         size_t partsCount = 0;
     };
 
+    struct RawProbe {
+        size_t measuresCount = 0;
+        double durationSecs = 0.0;
+
+        int timeSigNumerator = 4;
+        int timeSigDenominator = 4;
+        double tempo = 2.0; // beats (quarters) per second
+
+        std::vector<int> keySignatures;
+        QStringList timeSignatures;
+    };
+
     muse::Ret prepareReader(const muse::io::path_t& filePath, mu::engraving::MscReader& reader) const;
 
-    void doReadMeta(muse::XmlStreamReader& xmlReader, ProjectMeta& meta) const;
+    void doReadMeta(muse::XmlStreamReader& xmlReader, ProjectMeta& meta, RawProbe* probe = nullptr) const;
     RawMeta doReadBox(muse::XmlStreamReader& xmlReader) const;
-    RawMeta doReadRawMeta(muse::XmlStreamReader& xmlReader) const;
+    RawMeta doReadRawMeta(muse::XmlStreamReader& xmlReader, RawProbe* probe = nullptr) const;
+    void doReadMeasure(muse::XmlStreamReader& xmlReader, RawProbe& probe) const;
+    void doReadMeasureElement(muse::XmlStreamReader& xmlReader, RawProbe& probe) const;
     QString formatFromXml(const std::string& xml) const;
 
     QString format(const std::string& str) const;
@@ -35,6 +35,7 @@
 #include "engraving/compat/engravingcompat.h"
 #include "engraving/dom/excerpt.h"
 #include "engraving/dom/masterscore.h"
+#include "engraving/dom/measure.h"
 #include "engraving/dom/repeatlist.h"
 #include "engraving/editing/editscoreproperties.h"
 #include "engraving/engravingerrors.h"
@@ -212,6 +213,13 @@ Ret NotationProject::doLoad(const muse::io::path_t& path, const OpenParams& open
         delete original;
         m_engravingProject->setMasterScore(masterScore);
     } else {
+        if (openParams.layoutPageCount > 0 || openParams.layoutMeasureCount > 0) {
+            const Measure* lastMeasure = openParams.layoutMeasureCount > 0
+                                         ? masterScore->crMeasure(static_cast<int>(openParams.layoutMeasureCount) - 1)
+                                         : nullptr;
+            masterScore->setLayoutLimit(openParams.layoutPageCount, lastMeasure ? lastMeasure->endTick() : Fraction::max());
+        }
+
         masterScore->lockUpdates(false);
         masterScore->setLayoutAll();
         masterScore->update();
@@ -693,54 +701,80 @@ Ret NotationProject::doSave(const muse::io::path_t& path, engraving::MscIoMode i
                                    && globalConfiguration()->devModeEnabled()
                                    && savePath.contains(" - ALL_ZEROS_CORRUPTED.mscz");
 
-        std::unique_ptr<Buffer> maybeOutBuf;
+#ifdef MUSE_THREADS_SUPPORT
+        // For autosave, only the serialization is done on the main thread,
+        // the compression and writing to disk are done on a background thread to avoid stuttering.
+        const bool writeInBackground = isAutosave && ioMode != engraving::MscIoMode::Dir;
+        if (writeInBackground && m_isAutosaveWriting->load()) {
+            LOGW() << "Autosave: the previous autosave is still being written, skipping";
+            return make_ret(Ret::Code::Cancel);
+        }
+        params.deferred = writeInBackground;
+#endif
+
+        std::shared_ptr<Buffer> maybeOutBuf;
         if (shouldCorrupt) {
             // Create corrupted data so devs/qa can simulate a saved corrupted file.
-            maybeOutBuf = std::make_unique<AllZerosBufferCorruptor>();
+            maybeOutBuf = std::make_shared<AllZerosBufferCorruptor>();
         } else if (ioMode != engraving::MscIoMode::Dir) {
-            maybeOutBuf = std::make_unique<Buffer>();
+            maybeOutBuf = std::make_shared<Buffer>();
         }
         params.device = maybeOutBuf.get();
 
-        MscWriter msczWriter(params);
-        Ret ret = writeProject(msczWriter, createThumbnail, ctx);
-        msczWriter.close();
+        auto msczWriter = std::make_shared<MscWriter>(params);
+        Ret ret = writeProject(*msczWriter, createThumbnail, ctx);
+        msczWriter->close();
 
         if (!ret) {
             LOGE() << "failed write project to buffer: " << ret.toString();
             return ret;
         }
 
-        if (msczWriter.hasError()) {
+        if (msczWriter->hasError()) {
             LOGE() << "MscWriter has error after writing project";
             return make_ret(Ret::Code::UnknownError);
         }
 
         if (maybeOutBuf) {
 #ifdef MUSE_THREADS_SUPPORT
-            if (isAutosave) {
-                // For autosave, write to disk on a background thread to avoid stuttering.
-                // The buffer is fully serialized at this point so it's safe to move off the main thread.
-                muse::ByteArray data = maybeOutBuf->data();
+            if (writeInBackground) {
+                // The files are fully serialized at this point, the writer only holds their data,
+                // so it's safe to move it off the main thread.
                 QString savePathCopy = savePath;
                 QString targetContainerPathCopy = targetContainerPath;
                 muse::io::path_t targetMainFilePathCopy = targetMainFilePath;
                 auto fs = fileSystem();
-                Concurrent::run([fs, savePathCopy, targetContainerPathCopy, targetMainFilePathCopy, data]() {
-                    Ret writeRet = fs->writeFile(savePathCopy, data);
-                    if (!writeRet) {
-                        LOGE() << "Autosave: failed to write project file: " << writeRet.toString();
-                        return;
-                    }
-                    Ret copyRet = fs->copy(savePathCopy, targetContainerPathCopy, true);
-                    if (!copyRet) {
-                        LOGE() << "Autosave: failed to copy to target: " << copyRet.toString();
-                        return;
+                auto isWriting = m_isAutosaveWriting;
+                isWriting->store(true);
+                Concurrent::run([fs, msczWriter, maybeOutBuf, savePathCopy, targetContainerPathCopy, targetMainFilePathCopy,
+                                 isWriting]() {
+                    auto write = [&]() -> Ret {
+                        Ret writeRet = msczWriter->writeDeferredFiles();
+                        if (!writeRet) {
+                            LOGE() << "Autosave: failed to compress project: " << writeRet.toString();
+                            return writeRet;
+                        }
+                        writeRet = fs->writeFile(savePathCopy, maybeOutBuf->data());
+                        if (!writeRet) {
+                            LOGE() << "Autosave: failed to write project file: " << writeRet.toString();
+                            return writeRet;
+                        }
+                        writeRet = fs->copy(savePathCopy, targetContainerPathCopy, true);
+                        if (!writeRet) {
+                            LOGE() << "Autosave: failed to copy to target: " << writeRet.toString();
+                            return writeRet;
+                        }
+                        fs->remove(savePathCopy);
+                        QFile::setPermissions(targetMainFilePathCopy.toQString(),
+                                              QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
+                        return make_ok();
+                    };
+
+                    if (write()) {
+                        LOGD() << "Autosave: background write complete: " << targetContainerPathCopy;
                     }
-                    fs->remove(savePathCopy);
-                    QFile::setPermissions(targetMainFilePathCopy.toQString(),
-                                          QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
-                    LOGD() << "Autosave: background write complete: " << targetContainerPathCopy;
+
+                    isWriting->store(false);
                 });
                 return make_ret(Ret::Code::Ok);
             }
@@ -1062,19 +1096,16 @@ void NotationProject::listenIfNeedSaveChanges()
 
     auto listenNonUndoStackChanges = [this](const INotationPtr& notation) {
         notation->openChanged().onNotify(this, [this]() {
-            markAsUnsaved();
-            m_hasNonUndoStackChanges = true;
+            markNonUndoStackChanges();
         }, Mode::SetReplace);
 
         notation->viewState()->stateChanged().onNotify(this, [this]() {
-            markAsUnsaved();
-            m_hasNonUndoStackChanges = true;
+            markNonUndoStackChanges();
         }, Mode::SetReplace);
 
         notation->soloMuteState()->trackSoloMuteStateChanged().onReceive(
             this, [this](const InstrumentTrackId&, const notation::INotationSoloMuteState::SoloMuteState&) {
-            markAsUnsaved();
-            m_hasNonUndoStackChanges = true;
+            markNonUndoStackChanges();
         }, Mode::SetReplace);
     };
 
@@ -1091,11 +1122,22 @@ void NotationProject::listenIfNeedSaveChanges()
     });
 
     m_projectAudioSettings->settingsChanged().onNotify(this, [this]() {
-        markAsUnsaved();
-        m_hasNonUndoStackChanges = true;
+        markNonUndoStackChanges();
     });
 }
 
+void NotationProject::markNonUndoStackChanges()
+{
+    markAsUnsaved();
+    m_hasNonUndoStackChanges = true;
+
+    //! NOTE The change revisions don't count these changes, so the parts and the thumbnail
+    //! written before them are not reused by the next save or autosave
+    if (mu::engraving::MasterScore* score = m_masterNotation->masterScore()) {
+        score->invalidateWriteCaches();
+    }
+}
+
 void NotationProject::markAsSaved(const muse::io::path_t& path)
 {
     TRACEFUNC;
@@ -21,6 +21,9 @@
  */
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include "../inotationproject.h"
 
 #include "async/asyncable.h"
@@ -134,6 +137,7 @@ private:
     muse::Ret checkSavedFileForCorruption(engraving::MscIoMode ioMode, const muse::io::path_t& path, const muse::io::path_t& scoreFileName);
 
     void listenIfNeedSaveChanges();
+    void markNonUndoStackChanges();
     void markAsSaved(const muse::io::path_t& path);
     void setNeedSave(bool needSave);
 
@@ -156,5 +160,7 @@ private:
     bool m_needSave = false;
     bool m_needAutoSave = false;
     bool m_hasNonUndoStackChanges = false;
+
+    std::shared_ptr<std::atomic<bool> > m_isAutosaveWriting = std::make_shared<std::atomic<bool> >(false);
 };
 }
@@ -33,5 +33,6 @@ public:
     MOCK_METHOD(muse::RetVal<QPixmap>, readThumbnail, (const muse::io::path_t& filePath), (const, override));
     MOCK_METHOD(muse::RetVal<project::ProjectMeta>, readMeta, (const muse::io::path_t& filePath), (const, override));
     MOCK_METHOD(muse::RetVal<project::CloudProjectInfo>, readCloudProjectInfo, (const muse::io::path_t& filePath), (const, override));
+    MOCK_METHOD(muse::RetVal<project::ProjectProbe>, probe, (const muse::io::path_t& filePath), (const, override));
 };
 }
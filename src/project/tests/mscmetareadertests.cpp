@@ -105,3 +105,20 @@ TEST(ProjectMscMetaReaderTests, testReadCloudInfo)
     EXPECT_EQ(cloudInfo.revisionId, 42);
     EXPECT_TRUE(cloudInfo.name.isEmpty());
 }
+
+TEST(ProjectMscMetaReaderTests, testProbe)
+{
+    auto metaReader = std::make_shared<MscMetaReader>();
+    muse::RetVal<ProjectProbe> maybeProbe = metaReader->probe(getDataPath("from_meta/from_meta.mscx"));
+    ASSERT_TRUE(maybeProbe.ret);
+
+    const ProjectProbe& probe = maybeProbe.val;
+    EXPECT_EQ(probe.meta.title, u"Title from tag"_s);
+    EXPECT_EQ(probe.meta.composer, u"Composer from tag"_s);
+    EXPECT_EQ(probe.meta.partsCount, 1);
+
+    EXPECT_EQ(probe.measuresCount, 1);
+    EXPECT_DOUBLE_EQ(probe.durationSecs, 2.0); // one 4/4 measure at the default 120 BPM
+    EXPECT_TRUE(probe.keySignatures.empty());
+    EXPECT_EQ(probe.timeSignatures, QStringList { u"4/4"_s });
+}
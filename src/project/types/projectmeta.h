@@ -22,10 +22,13 @@
 #ifndef MU_PROJECT_PROJECTMETA_H
 #define MU_PROJECT_PROJECTMETA_H
 
+#include <vector>
+
 #include <QDate>
 #include <QPixmap>
 #include <QSet>
 #include <QString>
+#include <QStringList>
 
 #include "io/path.h"
 
@@ -95,6 +98,18 @@ struct ProjectMeta
 
 using ProjectMetaList = QList<ProjectMeta>;
 
+//! NOTE Catalog data collected by streaming the score file, without loading the score
+struct ProjectProbe
+{
+    ProjectMeta meta;
+
+    size_t measuresCount = 0;
+    double durationSecs = 0.0; // estimated from the tempo and time signature changes, repeats are not played out
+
+    std::vector<int> keySignatures; // concert keys in fifths, as they appear in the score
+    QStringList timeSignatures; // "numerator/denominator", as they appear in the score
+};
+
 // Tags
 inline const QString WORK_TITLE_TAG("workTitle");
 inline const QString WORK_NUMBER_TAG("workNumber");
@@ -60,6 +60,11 @@ struct OpenParams {
     bool forceMode = false;
     bool forcePageMode = false;
     bool unrollRepeats = false;
+
+    //! NOTE For one-off exports of the first pages or measures: the score is laid out
+    //! only as far as needed to reproduce them exactly (0 - the whole score)
+    size_t layoutPageCount = 0;
+    size_t layoutMeasureCount = 0;
 };
 
 struct MigrationOptions
@@ -94,7 +94,7 @@ function compareDrawData(optName)
         isMakePng: true
     }
 
-    let files = api.filesystem.scanFiles(CURR_DIR, [], "FilesInCurrentDir").value
+    let files = api.filesystem.scanFiles(CURR_DIR, ["*.json"], "FilesInCurrentDir").value
     for (let  i = 0; i < files.length; ++i) {
         let fileName = api.filesystem.baseName(files[i])
         let refFile = REF_DIR + "/" + fileName + ".json"
@@ -116,7 +116,7 @@ function compareDrawData(optName)
 
 function createDataPngs(optName)
 {
-    let files = api.filesystem.scanFiles(CURRENT_DATA_DIR+"/"+optName, [], "FilesInCurrentDir").value
+    let files = api.filesystem.scanFiles(CURRENT_DATA_DIR+"/"+optName, ["*.json"], "FilesInCurrentDir").value
     for (let  i = 0; i < files.length; ++i) {
         let file = files[i]
         api.diagnostics.drawDataToPng(file, file + ".png");
@@ -22,6 +22,12 @@
 
 #include <gtest/gtest.h>
 
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QProcess>
 #include <QTextStream>
 
@@ -58,6 +64,28 @@ static int run_command(const QString& name, const QStringList& args)
     return code;
 }
 
+static int run_mscore(const QStringList& args)
+{
+    QProcess p;
+    p.setProcessChannelMode(QProcess::ForwardedChannels);
+    p.start(MSCORE_BIN, args);
+
+    if (!p.waitForFinished(60000 * 5)) {
+        return -1;
+    }
+
+    return p.exitCode();
+}
+
+static QByteArray read_file(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    return file.readAll();
+}
+
 TEST_F(Engraving_VTest, 1_GenerateRef)
 {
     ASSERT_EQ(run_command("vtest-generate-pngs.sh",
@@ -79,3 +107,47 @@ TEST_F(Engraving_VTest, 2_GenerateCurrentAndCompare)
                           { "--gen-gif", "0"
                           }), 0);
 }
+
+TEST_F(Engraving_VTest, 3_BatchWorkersMatchSequential)
+{
+    // [GIVEN] A batch job converting a few scores to PNG and SVG
+    const QStringList scores { "Accidentals.mscz", "Arpeggios.mscz", "Barlines.mscz", "Clefs.mscz" };
+    const QString outDir = QDir::currentPath() + "/batch_workers";
+    QDir(outDir).removeRecursively();
+
+    auto writeJob = [&scores, &outDir](const QString& subdir) {
+        QDir().mkpath(outDir + "/" + subdir);
+
+        QJsonArray job;
+        for (const QString& score : scores) {
+            const QString base = outDir + "/" + subdir + "/" + QFileInfo(score).completeBaseName();
+            job.append(QJsonObject {
+                { "in", ROOT_DIR + "/scores_small/" + score },
+                { "out", QJsonArray { base + ".png", base + ".svg" } },
+            });
+        }
+
+        const QString jobPath = outDir + "/" + subdir + ".json";
+        QFile file(jobPath);
+        file.open(QIODevice::WriteOnly);
+        file.write(QJsonDocument(job).toJson());
+        return jobPath;
+    };
+
+    // [GIVEN] Non-default options, that the workers must get as well
+    const QStringList options { "-r", "75", "-T", "5", "-S", ROOT_DIR + "/small.mss" };
+
+    // [WHEN] Convert sequentially and in worker processes
+    ASSERT_EQ(run_mscore(QStringList(options) << "-j" << writeJob("sequential")), 0);
+    ASSERT_EQ(run_mscore(QStringList(options) << "-j" << writeJob("workers") << "--batch-workers" << "2"), 0);
+
+    // [THEN] The outputs are the same
+    for (const QString& score : scores) {
+        for (const QString& suffix : { QString("-1.png"), QString("-1.svg") }) {
+            const QString name = QFileInfo(score).completeBaseName() + suffix;
+            const QByteArray sequential = read_file(outDir + "/sequential/" + name);
+            ASSERT_FALSE(sequential.isEmpty()) << name.toStdString();
+            EXPECT_EQ(sequential, read_file(outDir + "/workers/" + name)) << name.toStdString();
+        }
+    }
+}